@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_gpio.h
-* \version 1.0
+* \version 1.10
 *
 * Provides an API declaration of the GPIO driver
 *
@@ -44,6 +44,11 @@
 * - An entire port can be configured using \ref Cy_GPIO_Port_Init. Provide a filled
 *   cy_stc_gpio_prt_config_t structure. The values in the structure are
 *   bitfields representing the desired value for each pin in the port.
+* - A complete board can be configured from a const table of pins using
+*   \ref Cy_GPIO_Board_Init. The table entries of each port are merged into
+*   whole-register images, so every port register is written only once.
+*   Alternatively, the \ref group_gpio_prtConfig macros build a
+*   cy_stc_gpio_prt_config_t image at compile time for \ref Cy_GPIO_Port_Init.
 * - Pin configuration and management is based on the port address and pin number.
 *   \ref Cy_GPIO_PortToAddr function can optionally be used to calculate the port
 *   address from the port number at run-time.
@@ -83,6 +88,30 @@
 *
 * \snippet gpio/snippet/main.c Cy_GPIO_Snippet
 *
+* \ref Cy_GPIO_Port_Write and \ref Cy_GPIO_Port_Read access a set of pins of
+* a port selected by a mask. The write uses the port output data set and clear
+* registers, so the pins of the port outside of the mask are not affected and
+* no read-modify-write of the port output data register is required.
+*
+* A logical value that is wired to the pins of several ports (for example, an
+* 8-bit parallel LCD bus) is described by a cy_stc_gpio_pin_group_t
+* structure. It consists of segments of consecutive logical bits that are
+* mapped to consecutive pins of a port. \ref Cy_GPIO_PinGroup_Write writes the
+* value with two register writes per port and \ref Cy_GPIO_PinGroup_Read
+* reads it with one register read per port. In the example below, bits 0..3
+* of the value are wired to P1[4..7] and bits 4..7 are wired to P3[0..3]:
+*
+* \code
+* static const cy_stc_gpio_pin_group_seg_t lcdBusSeg[] =
+* {
+*     CY_GPIO_PIN_GROUP_SEG(GPIO_PRT1, 0UL, 4UL, 4UL),
+*     CY_GPIO_PIN_GROUP_SEG(GPIO_PRT3, 4UL, 0UL, 4UL),
+* };
+* static const cy_stc_gpio_pin_group_t lcdBus = {lcdBusSeg, 2UL};
+*
+* Cy_GPIO_PinGroup_Write(&lcdBus, data);
+* \endcode
+*
 * \section group_gpio_more_information More Information
 *
 * Refer to the technical reference manual (TRM) and the device datasheet.
@@ -122,6 +151,24 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="3">1.10</td>
+*     <td>Added \ref Cy_GPIO_Board_Init and the \ref group_gpio_prtConfig
+*         macros to configure ports from const tables with a single write
+*         per port register.</td>
+*     <td>Reduced the startup time and the code size of the board configuration.</td>
+*   </tr>
+*   <tr>
+*     <td>\ref Cy_GPIO_Pin_Init applies the vtrip and slewRate settings
+*         to the corresponding port fields.</td>
+*     <td>Bug fix.</td>
+*   </tr>
+*   <tr>
+*     <td>Added \ref Cy_GPIO_Port_Write, \ref Cy_GPIO_Port_Read,
+*         \ref Cy_GPIO_PinGroup_Write and \ref Cy_GPIO_PinGroup_Read.</td>
+*     <td>Multiple pins of a parallel bus can be accessed with a single
+*         register access per port.</td>
+*   </tr>
+*   <tr>
 *     <td>1.0</td>
 *     <td>Initial version</td>
 *     <td></td>
@@ -160,7 +207,7 @@ extern "C" {
 #define CY_GPIO_DRV_VERSION_MAJOR       1
 
 /** Driver minor version */
-#define CY_GPIO_DRV_VERSION_MINOR       0
+#define CY_GPIO_DRV_VERSION_MINOR       10
 
 /** GPIO driver ID */
 #define CY_GPIO_ID CY_PDL_DRV_ID(0x16U)
@@ -244,6 +291,30 @@ typedef struct
     uint32_t vohSel;         /**< SIO pair regulated voltage output level */
 } cy_stc_gpio_pin_config_t;
 
+/** This structure is used to describe a single pin of the board configuration table */
+typedef struct
+{
+    uint32_t portNum;                           /**< Port number */
+    uint32_t pinNum;                            /**< Pin number within the port */
+    const cy_stc_gpio_pin_config_t *config;     /**< Pin configuration */
+} cy_stc_gpio_board_pin_t;
+
+/** This structure describes consecutive bits of a pin group mapped to consecutive pins of a port */
+typedef struct
+{
+    GPIO_PRT_Type* base;     /**< Pointer to the port register base address */
+    uint32_t bitPos;         /**< Position of the first bit of the segment within the logical value */
+    uint32_t pinPos;         /**< Number of the first pin of the segment within the port */
+    uint32_t mask;           /**< Mask of the segment bits, right-aligned */
+} cy_stc_gpio_pin_group_seg_t;
+
+/** This structure describes a logical value mapped to pins of one or several ports */
+typedef struct
+{
+    const cy_stc_gpio_pin_group_seg_t *seg;   /**< Segments of the group. The segments of the same port must be adjacent */
+    uint32_t numSeg;                          /**< Number of the segments */
+} cy_stc_gpio_pin_group_t;
+
 /** \} group_gpio_data_structures */
 
 /***************************************
@@ -276,6 +347,7 @@ typedef struct
 #define CY_GPIO_VREF_SEL_SHIFT                 (0x03UL)   /**< Single SIO pin shift for voltage reference */
 #define CY_GPIO_VOH_SEL_MASK                   (0x07UL)   /**< Single SIO pin mask for VOH */
 #define CY_GPIO_VOH_SEL_SHIFT                  (0x05UL)   /**< Single SIO pin shift for VOH */
+#define CY_GPIO_SIO_CFG_MASK                   (0xFFUL)   /**< SIO pin pair configuration mask */
 
 /* Special mask for SIO pin pair setting */
 #define CY_GPIO_SIO_ODD_PIN_MASK               (0x00FEUL) /**< SIO pin pair selection mask */
@@ -473,6 +545,79 @@ typedef struct
 #define CY_SIO_VOH_4_16                        (0x07UL) /**< Voh = 4.16 x Reference */
 /** \} */
 
+/**
+* \defgroup group_gpio_prtConfig Port configuration image
+* \{
+* Macros to build the fields of the cy_stc_gpio_prt_config_t structure at
+* compile time from the per-pin settings. The values of the pins are combined
+* with the bitwise OR, so a const structure can be placed in flash and
+* applied by \ref Cy_GPIO_Port_Init with a single write per port register:
+*
+* \code
+* const cy_stc_gpio_prt_config_t port1Config =
+* {
+*     .dr        = CY_GPIO_PRT_DR(0UL, 1UL) | CY_GPIO_PRT_DR(1UL, 0UL),
+*     .intrCfg   = CY_GPIO_PRT_INTR_CFG(1UL, CY_GPIO_INTR_FALLING),
+*     .pc        = CY_GPIO_PRT_PC(0UL, CY_GPIO_DM_STRONG_IN_OFF) |
+*                  CY_GPIO_PRT_PC(1UL, CY_GPIO_DM_PULLUP) |
+*                  CY_GPIO_PRT_PC_PORT(CY_GPIO_VTRIP_CMOS, CY_GPIO_SLEW_FAST),
+*     .pc2       = CY_GPIO_PRT_PC2(0UL, CY_GPIO_DM_STRONG_IN_OFF) |
+*                  CY_GPIO_PRT_PC2(1UL, CY_GPIO_DM_PULLUP),
+*     .sio       = 0UL,
+*     .selActive = CY_GPIO_PRT_SEL(0UL, HSIOM_SEL_GPIO) | CY_GPIO_PRT_SEL(1UL, HSIOM_SEL_GPIO),
+* };
+* \endcode
+*/
+
+/** The DR register image of the pin output state */
+#define CY_GPIO_PRT_DR(pinNum, outVal)          (((uint32_t)(outVal) & CY_GPIO_DR_MASK) << (pinNum))
+
+/** The PC register image of the pin drive mode */
+#define CY_GPIO_PRT_PC(pinNum, driveMode)       (((uint32_t)(driveMode) & CY_GPIO_PC_DM_MASK) << \
+                                                 ((pinNum) * CY_GPIO_DRIVE_MODE_OFFSET))
+
+/** The PC register image of the port-wide input buffer voltage trip type and output slew rate */
+#define CY_GPIO_PRT_PC_PORT(vtrip, slewRate)    (_VAL2FLD(GPIO_PRT_PC_PORT_VTRIP_SEL, (vtrip)) | \
+                                                 _VAL2FLD(GPIO_PRT_PC_PORT_SLOW, (slewRate)))
+
+/** The PC2 register image of the pin input buffer state for the pin drive mode */
+#define CY_GPIO_PRT_PC2(pinNum, driveMode)      ((((uint32_t)(driveMode) & CY_GPIO_DM_VAL_IBUF_DISABLE_MASK) >> \
+                                                  CY_GPIO_INBUF_OFFSET) << (pinNum))
+
+/** The INTR_CFG register image of the pin interrupt edge type */
+#define CY_GPIO_PRT_INTR_CFG(pinNum, intEdge)   (((uint32_t)(intEdge) & CY_GPIO_INTR_EDGE_MASK) << \
+                                                 ((pinNum) << CY_GPIO_INTR_CFG_OFFSET))
+
+/** The HSIOM PORT_SEL register image of the pin HSIOM selection */
+#define CY_GPIO_PRT_SEL(pinNum, hsiom)          (((uint32_t)(hsiom) & CY_GPIO_HSIOM_MASK) << \
+                                                 ((pinNum) << CY_GPIO_HSIOM_OFFSET))
+
+/** The SIO register image of the SIO pair the pin belongs to */
+#define CY_GPIO_PRT_SIO(pinNum, vregEn, ibufMode, vtripSel, vrefSel, vohSel) \
+                                                ((((uint32_t)(vregEn) & CY_GPIO_VREG_EN_MASK) | \
+                                                  (((uint32_t)(ibufMode) & CY_GPIO_IBUF_MASK) << CY_GPIO_IBUF_SHIFT) | \
+                                                  (((uint32_t)(vtripSel) & CY_GPIO_VTRIP_SEL_MASK) << CY_GPIO_VTRIP_SEL_SHIFT) | \
+                                                  (((uint32_t)(vrefSel) & CY_GPIO_VREF_SEL_MASK) << CY_GPIO_VREF_SEL_SHIFT) | \
+                                                  (((uint32_t)(vohSel) & CY_GPIO_VOH_SEL_MASK) << CY_GPIO_VOH_SEL_SHIFT)) << \
+                                                 (((uint32_t)(pinNum) & CY_GPIO_SIO_ODD_PIN_MASK) << CY_GPIO_CFG_SIO_OFFSET))
+/** \} */
+
+/**
+* \defgroup group_gpio_pinGroup Pin group
+* \{
+* Macros to describe the pin groups, see \ref cy_stc_gpio_pin_group_t.
+*/
+
+/**
+* Initializer of the cy_stc_gpio_pin_group_seg_t structure: the width bits of
+* the logical value starting from bitPos are mapped to the pins of the port
+* starting from pinPos. The width must be 1 or more. The mask is built by a
+* right shift, so it is defined for any width up to 32.
+*/
+#define CY_GPIO_PIN_GROUP_SEG(base, bitPos, pinPos, width) \
+                                                {(base), (bitPos), (pinPos), (uint32_t)(0xFFFFFFFFUL >> (32UL - (width)))}
+/** \} */
+
 /** \} group_gpio_macros */
 
 /***************************************
@@ -491,6 +636,7 @@ typedef struct
 
 cy_en_gpio_status_t Cy_GPIO_Pin_Init(GPIO_PRT_Type* base, uint32_t pinNum, const cy_stc_gpio_pin_config_t *config);
 cy_en_gpio_status_t Cy_GPIO_Port_Init(GPIO_PRT_Type* base, const cy_stc_gpio_prt_config_t *config);
+cy_en_gpio_status_t Cy_GPIO_Board_Init(const cy_stc_gpio_board_pin_t *pins, uint32_t numPins);
 __STATIC_INLINE void Cy_GPIO_Pin_FastInit(GPIO_PRT_Type* base, uint32_t pinNum, uint32_t driveMode, uint32_t outVal, en_hsiom_sel_t hsiom);
 __STATIC_INLINE void Cy_GPIO_Port_Deinit(GPIO_PRT_Type* base);
 __STATIC_INLINE void Cy_GPIO_SetHSIOM(const GPIO_PRT_Type* base, uint32_t pinNum, en_hsiom_sel_t value);
@@ -513,6 +659,10 @@ __STATIC_INLINE uint32_t Cy_GPIO_ReadOut(const GPIO_PRT_Type* base, uint32_t pin
 __STATIC_INLINE void Cy_GPIO_Set(GPIO_PRT_Type* base, uint32_t pinNum);
 __STATIC_INLINE void Cy_GPIO_Clr(GPIO_PRT_Type* base, uint32_t pinNum);
 __STATIC_INLINE void Cy_GPIO_Inv(GPIO_PRT_Type* base, uint32_t pinNum);
+__STATIC_INLINE void Cy_GPIO_Port_Write(GPIO_PRT_Type* base, uint32_t mask, uint32_t value);
+__STATIC_INLINE uint32_t Cy_GPIO_Port_Read(const GPIO_PRT_Type* base, uint32_t mask);
+void Cy_GPIO_PinGroup_Write(const cy_stc_gpio_pin_group_t *group, uint32_t value);
+uint32_t Cy_GPIO_PinGroup_Read(const cy_stc_gpio_pin_group_t *group);
 __STATIC_INLINE void Cy_GPIO_SetDrivemode(GPIO_PRT_Type* base, uint32_t pinNum, uint32_t value);
 __STATIC_INLINE uint32_t Cy_GPIO_GetDrivemode(const GPIO_PRT_Type* base, uint32_t pinNum);
 __STATIC_INLINE void Cy_GPIO_SetVtrip(GPIO_PRT_Type* base, uint32_t value);
@@ -942,6 +1092,63 @@ __STATIC_INLINE void Cy_GPIO_Inv(GPIO_PRT_Type* base, uint32_t pinNum)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_GPIO_Port_Write
+****************************************************************************//**
+*
+* Writes the logic states to the output drivers of the pins selected by the
+* mask. The other pins of the port are not affected.
+*
+* The pins driven high are updated first, followed by the pins driven low.
+*
+* This function should be used only for software driven pins. It does not have
+* any effect on peripheral driven pins.
+*
+* \param base
+* Pointer to the pin's port register base address
+*
+* \param mask
+* Mask of the pins to be written. Bit position 0 is pin 0 of the port.
+*
+* \param value
+* Logic levels to drive out on the pins
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_GPIO_Port_Write(GPIO_PRT_Type* base, uint32_t mask, uint32_t value)
+{
+    CY_ASSERT_L2(CY_GPIO_IS_PIN_BIT_VALID(mask));
+
+    /* Thread-safe: Directly access the pin registers instead of base->OUT */
+    GPIO_PRT_OUT_SET(base) = mask & value;
+    GPIO_PRT_OUT_CLR(base) = mask & ~value;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_GPIO_Port_Read
+****************************************************************************//**
+*
+* Reads the current logic levels on the input buffers of the pins selected by
+* the mask.
+*
+* \param base
+* Pointer to the pin's port register base address
+*
+* \param mask
+* Mask of the pins to be read. Bit position 0 is pin 0 of the port.
+*
+* \return
+* Logic levels present on the pins, the bits outside of the mask are zero
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t Cy_GPIO_Port_Read(const GPIO_PRT_Type* base, uint32_t mask)
+{
+    CY_ASSERT_L2(CY_GPIO_IS_PIN_BIT_VALID(mask));
+
+    return (GPIO_PRT_IN(base) & mask);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_GPIO_SetDrivemode
 ****************************************************************************//**
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_common.h
-* \version 1.0
+* \version 1.10
 *
 * Provides common API declarations of the SCB driver.
 *
@@ -131,6 +131,68 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="9">1.10</td>
+*     <td>Added \ref Cy_SCB_UART_GetRingBufferReadSpan and
+*         \ref Cy_SCB_UART_CommitRingBufferRead to process the UART receive
+*         ring buffer data in place.</td>
+*     <td>Removed the copy of the ring buffer data required by
+*         \ref Cy_SCB_UART_Receive.</td>
+*   </tr>
+*   <tr>
+*     <td>Fixed \ref Cy_SCB_UART_GetNumInRingBuffer to use the ring buffer
+*         size when the stored data wraps around the end of the ring buffer.</td>
+*     <td>Defect fixing.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the 8-bit and 16-bit FIFO access functions with unrolled
+*         loops. The UART, SPI, I2C and EZI2C interrupt handlers use them
+*         with the data width stored in the context at initialization.</td>
+*     <td>Reduced the interrupt processing time per data element.</td>
+*   </tr>
+*   <tr>
+*     <td>Added \ref Cy_SCB_SPI_TransferQueue to execute a list of SPI master
+*         transfers from \ref Cy_SCB_SPI_Interrupt, optionally keeping
+*         the slave select asserted between the transfers.</td>
+*     <td>Removed the software intervention between the transfers of
+*         multi-phase SPI transactions.</td>
+*   </tr>
+*   <tr>
+*     <td>Added \ref Cy_SCB_I2C_MasterTransfer to execute a sequence of read
+*         and write messages separated by ReStart conditions from
+*         \ref Cy_SCB_I2C_Interrupt.</td>
+*     <td>Removed the blocking low-level calls required for the combined
+*         I2C transactions.</td>
+*   </tr>
+*   <tr>
+*     <td>The I2C master Low-Level functions measure the timeout with
+*         \ref Cy_SysTick_TimeoutStart and \ref Cy_SysTick_TimeoutExpired
+*         when the SysTick time base is running, instead of 1 us delays
+*         between status checks.</td>
+*     <td>Reduced the reaction time to the bus events and improved the
+*         timeout accuracy under the interrupt load.</td>
+*   </tr>
+*   <tr>
+*     <td>The EZI2C slave configured to support two addresses receives
+*         the write data using the RX FIFO and the hardware data ACK.</td>
+*     <td>Removed the interrupt per received byte.</td>
+*   </tr>
+*   <tr>
+*     <td>Added \ref Cy_SCB_EZI2C_PublishBuffer1, \ref Cy_SCB_EZI2C_PublishBuffer2
+*         and \ref Cy_SCB_EZI2C_IsPublishPending to switch the EZI2C
+*         buffers between transactions. Fixed \ref Cy_SCB_EZI2C_Init to
+*         initialize the secondary buffer size.</td>
+*     <td>Consistent multi-byte data updates without critical sections.
+*         Defect fixing.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the UART transmit ring buffer:
+*         \ref Cy_SCB_UART_StartTxRingBuffer, \ref Cy_SCB_UART_StopTxRingBuffer,
+*         \ref Cy_SCB_UART_PutTxRingBuffer and
+*         \ref Cy_SCB_UART_GetNumInTxRingBuffer. The UART transmit interrupt
+*         no longer uses a critical section to write the last data element.</td>
+*     <td>Continuous transmission without disabling interrupts.</td>
+*   </tr>
+*   <tr>
 *     <td>1.0</td>
 *     <td>Initial version.</td>
 *     <td></td>
@@ -268,6 +330,13 @@ void     Cy_SCB_WriteString       (CySCB_Type *base, char_t const string[]);
 void     Cy_SCB_WriteDefaultArrayNoCheck(CySCB_Type *base, uint32_t txData, uint32_t size);
 uint32_t Cy_SCB_WriteDefaultArray (CySCB_Type *base, uint32_t txData, uint32_t size);
 
+void     Cy_SCB_ReadArrayNoCheck8  (CySCB_Type const *base, uint8_t  buffer[], uint32_t size);
+void     Cy_SCB_ReadArrayNoCheck16 (CySCB_Type const *base, uint16_t buffer[], uint32_t size);
+uint32_t Cy_SCB_ReadArray8         (CySCB_Type const *base, uint8_t  buffer[], uint32_t size);
+void     Cy_SCB_WriteArrayNoCheck8 (CySCB_Type *base, uint8_t  const buffer[], uint32_t size);
+void     Cy_SCB_WriteArrayNoCheck16(CySCB_Type *base, uint16_t const buffer[], uint32_t size);
+uint32_t Cy_SCB_WriteArray8        (CySCB_Type *base, uint8_t  const buffer[], uint32_t size);
+
 __STATIC_INLINE uint32_t Cy_SCB_GetFifoSize (CySCB_Type const *base);
 __STATIC_INLINE void     Cy_SCB_FwBlockReset(CySCB_Type *base);
 __STATIC_INLINE bool     Cy_SCB_IsRxDataWidthByte(CySCB_Type const *base);
@@ -291,7 +360,7 @@ __STATIC_INLINE uint32_t Cy_SCB_GetRxFifoLevel   (CySCB_Type const *base);
 #define CY_SCB_DRV_VERSION_MAJOR    (1)
 
 /** Driver minor version */
-#define CY_SCB_DRV_VERSION_MINOR    (0)
+#define CY_SCB_DRV_VERSION_MINOR    (10)
 
 /** SCB driver identifier */
 #define CY_SCB_ID           CY_PDL_DRV_ID(0x2AU)
@@ -592,6 +661,9 @@ __STATIC_INLINE uint32_t Cy_SCB_GetRxFifoLevel   (CySCB_Type const *base);
 /* Hardware FIFO size: EZ_DATA_NR / 2 = (32 / 2) = 16 */
 #define CY_SCB_FIFO_SIZE            (16UL)
 
+/* Number of data elements accessed per unrolled FIFO loop iteration */
+#define CY_SCB_FIFO_BURST_SIZE      (4UL)
+
 /* Provides a list of allowed sources */
 #define CY_SCB_TX_INTR_MASK     (CY_SCB_TX_INTR_LEVEL     | CY_SCB_TX_INTR_NOT_FULL  | CY_SCB_TX_INTR_EMPTY     | \
                                  CY_SCB_TX_INTR_OVERFLOW  | CY_SCB_TX_INTR_UNDERFLOW | CY_SCB_TX_INTR_UART_DONE | \
@@ -86,6 +86,12 @@
 *
 * \snippet scb/ezi2c_snippet/main.c EZI2C_CFG_BUFFER
 *
+* To update multi-byte data exposed to the master without a critical section,
+* prepare the data in a second buffer of the same size and call
+* \ref Cy_SCB_EZI2C_PublishBuffer1 (or \ref Cy_SCB_EZI2C_PublishBuffer2).
+* The driver switches the buffers between transactions, and the previous
+* buffer can be reused after \ref Cy_SCB_EZI2C_IsPublishPending returns false.
+*
 ********************************************************************************
 * \subsection group_scb_ezi2c_pins Assign and Configure Pins
 ********************************************************************************
@@ -223,6 +229,10 @@
 *   and 0x30. Firmware is required to ACK only the primary and secondary 
 *   addresses 0x24 and 0x30 and NAK all others 0x20 and 0x34.
 *
+* The write transfers of at least the FIFO size are received using the RX FIFO
+* and the hardware data ACK for both the single and two address
+* configurations. The shorter transfers are ACKed by firmware byte by byte.
+*
 * \note
 * For proper operation, when the EZI2C slave is configured to be a wakeup 
 * source from Deep Sleep mode, the \ref Cy_SCB_EZI2C_DeepSleepCallback must 
@@ -357,10 +367,12 @@ typedef struct cy_stc_scb_ezi2c_context
     uint32_t bufSize;     /**< Specifies how many bytes are left in the current buffer */
 
     uint8_t *buf1;          /**< The pointer to the buffer exposed  on the request intended for the primary slave address */
+    uint8_t * volatile buf1Pending; /**< The pointer to the buffer to expose for the primary slave address after the transaction */
     uint32_t buf1Size;      /**< The buffer size assigned to the primary slave address */
     uint32_t buf1rwBondary; /**< The Read/Write boundary within the buffer assigned to the primary slave address */
 
     uint8_t *buf2;          /**< The pointer to the buffer exposed on the request intended for the secondary slave address */
+    uint8_t * volatile buf2Pending; /**< The pointer to the buffer to expose for the secondary slave address after the transaction */
     uint32_t buf2Size;      /**< The buffer size assigned to the secondary slave address */
     uint32_t buf2rwBondary; /**< The Read/Write boundary within the buffer assigned for the secondary slave address */
     /** \endcond */
@@ -398,6 +410,10 @@ void Cy_SCB_EZI2C_SetBuffer1(CySCB_Type const *base, uint8_t *buffer, uint32_t s
 void Cy_SCB_EZI2C_SetBuffer2(CySCB_Type const *base, uint8_t *buffer, uint32_t size, uint32_t rwBoundary,
                              cy_stc_scb_ezi2c_context_t *context);
 
+void Cy_SCB_EZI2C_PublishBuffer1(CySCB_Type const *base, uint8_t *buffer, cy_stc_scb_ezi2c_context_t *context);
+void Cy_SCB_EZI2C_PublishBuffer2(CySCB_Type const *base, uint8_t *buffer, cy_stc_scb_ezi2c_context_t *context);
+bool Cy_SCB_EZI2C_IsPublishPending(CySCB_Type const *base, cy_stc_scb_ezi2c_context_t const *context);
+
 uint32_t Cy_SCB_EZI2C_GetActivity(CySCB_Type const *base, cy_stc_scb_ezi2c_context_t *context);
 
 void Cy_SCB_EZI2C_Interrupt(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
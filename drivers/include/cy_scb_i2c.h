@@ -206,6 +206,14 @@
 *
 * \snippet scb/i2c_snippet/main.c I2C_MASTER_WRITE_READ_INT
 *
+* To execute several messages as one transaction (for example, write a
+* register address and then read the register content), call
+* \ref Cy_SCB_I2C_MasterTransfer with an array of
+* \ref cy_stc_scb_i2c_master_msg_t. The \ref Cy_SCB_I2C_Interrupt generates
+* a ReStart condition between the messages and a Stop condition after the last
+* one. The completion events are generated once the whole transaction is
+* complete.
+*
 ********************************************************************************
 * \subsubsection group_scb_i2c_master_ll Use Low-Level Functions
 ********************************************************************************
@@ -224,6 +232,9 @@
 * \ref Cy_SCB_I2C_Interrupt inside the interrupt handler. Using these
 * functions requires extensive knowledge of the I2C protocol to execute
 * transactions correctly.
+* The timeout of the Low-Level functions is a SysTick deadline when
+* \ref Cy_SysTick_IsTimeBaseRunning returns true at the call. Otherwise, the
+* functions wait in 1 us delay units between status checks.
 *
 * <b>Master Write Operation</b>
 * \snippet scb/i2c_snippet/main.c I2C_MASTER_WRITE_MANUAL
@@ -544,6 +555,25 @@ typedef struct cy_stc_scb_i2c_config
 
 } cy_stc_scb_i2c_config_t;
 
+/** The I2C Master message structure used by \ref Cy_SCB_I2C_MasterTransfer */
+typedef struct cy_stc_scb_i2c_master_msg
+{
+    /** The 7-bit right justified slave address to communicate with */
+    uint8_t  slaveAddress;
+
+    /** The direction of the message: read from or write to the slave */
+    cy_en_scb_i2c_direction_t direction;
+
+    /**
+    * The pointer to the buffer for data to read from the slave or
+    * data to write into the slave
+    */
+    uint8_t  *buffer;
+
+    /** The size of the buffer */
+    uint32_t bufferSize;
+} cy_stc_scb_i2c_master_msg_t;
+
 /** I2C context structure.
 * All fields for the context structure are internal. Firmware never reads or
 * writes these values. Firmware allocates the structure and provides the
@@ -563,6 +593,10 @@ typedef struct cy_stc_scb_i2c_context
     bool     masterPause;           /**< Stores how the master ends the transaction */
     bool     masterRdDir;           /**< The direction of the master transaction */
 
+    cy_stc_scb_i2c_master_msg_t const *masterMsg; /**< The pointer to the master message list */
+    uint32_t  masterMsgNum;     /**< The number of messages in the list */
+    uint32_t  masterMsgIdx;     /**< The message that is being transferred */
+
     uint8_t  *masterBuffer;     /**< The pointer to the master buffer (either for a transmit or a receive operation) */
     uint32_t  masterBufferSize;         /**< The current master buffer size */
     volatile uint32_t masterBufferIdx;  /**< The current location in the master buffer */
@@ -687,6 +721,8 @@ void     Cy_SCB_I2C_MasterAbortWrite         (CySCB_Type *base, cy_stc_scb_i2c_c
 cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead (CySCB_Type *base, cy_stc_scb_i2c_master_xfer_config_t const *xferConfig,
                                               cy_stc_scb_i2c_context_t *context);
 void     Cy_SCB_I2C_MasterAbortRead          (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterTransfer(CySCB_Type *base, cy_stc_scb_i2c_master_msg_t const *msgs,
+                                                 uint32_t numMsgs, cy_stc_scb_i2c_context_t *context);
 uint32_t Cy_SCB_I2C_MasterGetStatus          (CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context);
 uint32_t Cy_SCB_I2C_MasterGetTransferCount   (CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context);
 /** \} group_scb_i2c_master_low_high_functions */
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_spi.h
-* \version 1.0
+* \version 1.10
 *
 * Provides SPI API declarations of the SCB driver.
 *
@@ -206,6 +206,17 @@
 *
 * \snippet scb/spi_snippet/main.c SPI_TRANFER_DATA
 *
+* In master mode, \ref Cy_SCB_SPI_TransferQueue starts a sequence of transfers
+* described by a list of \ref cy_stc_scb_spi_xfer_desc_t (for example, a command
+* followed by a data phase, or transactions with several slaves). The
+* \ref Cy_SCB_SPI_Interrupt walks the list: when a descriptor requests to keep the
+* slave select asserted and the next one addresses the same slave, the data of
+* the next descriptor is loaded into the TX FIFO without a break. Otherwise,
+* the driver waits for the \ref CY_SCB_SPI_MASTER_DONE event, selects the
+* slave of the next descriptor, and continues the transfer. The
+* \ref CY_SCB_SPI_TRANSFER_CMPLT_EVENT is reported once after the last
+* descriptor is complete.
+*
 ********************************************************************************
 * \section group_scb_spi_dma_trig DMA Trigger
 ********************************************************************************
@@ -520,6 +531,37 @@ typedef struct cy_stc_scb_spi_config
 
 }cy_stc_scb_spi_config_t;
 
+/** SPI transfer descriptor used by \ref Cy_SCB_SPI_TransferQueue */
+typedef struct cy_stc_scb_spi_xfer_desc
+{
+    /**
+    * The pointer to the buffer with data to transmit. If NULL, the
+    * default transmit value is sent (see \ref Cy_SCB_SPI_Transfer).
+    */
+    void    *txBuf;
+
+    /**
+    * The pointer to the buffer to store received data. If NULL, the received
+    * data is discarded.
+    */
+    void    *rxBuf;
+
+    /** The number of data elements to transfer */
+    uint32_t size;
+
+    /** The slave select line to assert for this transfer */
+    cy_en_scb_spi_slave_select_t slaveSelect;
+
+    /**
+    * When true, the slave select remains asserted between this transfer and
+    * the next one in the queue if both use the same slave select line.
+    * Otherwise, the slave select is de-asserted after this transfer completes.
+    * Note that the slave select is kept asserted only while the TX FIFO does
+    * not run empty (see \ref group_scb_spi_hl).
+    */
+    bool     keepSsAsserted;
+} cy_stc_scb_spi_xfer_desc_t;
+
 /** SPI context structure.
 * All fields for the context structure are internal. Firmware never reads or
 * writes these values. Firmware allocates the structure and provides the
@@ -532,6 +574,9 @@ typedef struct cy_stc_scb_spi_context
     /** \cond INTERNAL */
     uint32_t volatile status;       /**< The receive status */
 
+    bool     rxByteMode;            /**< The receive data element size is one byte */
+    bool     txByteMode;            /**< The transmit data element size is one byte */
+
     void    *rxBuf;                 /**< The pointer to the receive buffer */
     uint32_t rxBufSize;             /**< The receive buffer size */
     uint32_t volatile rxBufIdx;     /**< The current location in the receive buffer */
@@ -540,6 +585,12 @@ typedef struct cy_stc_scb_spi_context
     uint32_t txBufSize;             /**< The transmit buffer size */
     uint32_t volatile txBufIdx;     /**< The current location in the transmit buffer */
 
+    cy_stc_scb_spi_xfer_desc_t const *xferDesc; /**< The pointer to the transfer descriptor list */
+    uint32_t xferDescNum;           /**< The number of descriptors in the list */
+    uint32_t volatile rxDescIdx;    /**< The descriptor that is being received */
+    uint32_t volatile txDescIdx;    /**< The descriptor that is being transmitted */
+    bool volatile xferSsDone;       /**< The slave select of the current descriptor is de-asserted */
+
     /**
     * The pointer to an event callback that is called when any of
     * \ref group_scb_spi_macros_callback_events occurs
@@ -584,6 +635,8 @@ __STATIC_INLINE bool Cy_SCB_SPI_IsBusBusy(CySCB_Type const *base);
 */
 cy_en_scb_spi_status_t Cy_SCB_SPI_Transfer(CySCB_Type *base, void *txBuffer, void *rxBuffer, uint32_t size,
                                            cy_stc_scb_spi_context_t *context);
+cy_en_scb_spi_status_t Cy_SCB_SPI_TransferQueue(CySCB_Type *base, cy_stc_scb_spi_xfer_desc_t const *descList,
+                                                uint32_t numDesc, cy_stc_scb_spi_context_t *context);
 void     Cy_SCB_SPI_AbortTransfer    (CySCB_Type *base, cy_stc_scb_spi_context_t *context);
 uint32_t Cy_SCB_SPI_GetTransferStatus(CySCB_Type const *base, cy_stc_scb_spi_context_t const *context);
 uint32_t Cy_SCB_SPI_GetNumTransfered (CySCB_Type const *base, cy_stc_scb_spi_context_t const *context);
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_uart.h
-* \version 1.0
+* \version 1.10
 *
 * Provides UART API declarations of the SCB driver.
 *
@@ -210,6 +210,22 @@
 * buffer and then sets up an interrupt to receive more data if the required
 * amount has not yet been read.
 *
+* The data stored in the ring buffer can also be consumed in place, without
+* copying it out. \ref Cy_SCB_UART_GetRingBufferReadSpan returns a pointer to
+* the oldest received data element and the number of elements that are
+* contiguous in the ring buffer memory from that location. After the data has
+* been processed, call \ref Cy_SCB_UART_CommitRingBufferRead to release it.
+* The \ref Cy_SCB_UART_Interrupt only updates the head index and the caller
+* only updates the tail index, so the ring buffer is not locked during
+* the readout. Do not mix these functions with \ref Cy_SCB_UART_Receive
+* while a receive operation is active.
+*
+* A transmit ring buffer, started by \ref Cy_SCB_UART_StartTxRingBuffer,
+* provides a continuous transmit stream. The producer appends data with
+* \ref Cy_SCB_UART_PutTxRingBuffer and the \ref Cy_SCB_UART_Interrupt moves it
+* into the TX FIFO. The "transfer done" interrupt source is enabled only when
+* the ring buffer is drained, and neither side disables interrupts.
+*
 ********************************************************************************
 * \section group_scb_uart_dma_trig DMA Trigger
 ********************************************************************************
@@ -541,12 +557,18 @@ typedef struct cy_stc_scb_uart_context
     /** \cond INTERNAL */
     uint32_t volatile txStatus;         /**< The transmit status */
     uint32_t volatile rxStatus;         /**< The receive status */
+    bool     byteMode;                  /**< The data element size is one byte */
 
     void     *rxRingBuf;                /**< The pointer to the ring buffer */
     uint32_t  rxRingBufSize;            /**< The ring buffer size */
     uint32_t volatile rxRingBufHead;    /**< The ring buffer head index */
     uint32_t volatile rxRingBufTail;    /**< The ring buffer tail index */
 
+    void     *txRingBuf;                /**< The pointer to the transmit ring buffer */
+    uint32_t  txRingBufSize;            /**< The transmit ring buffer size */
+    uint32_t volatile txRingBufHead;    /**< The transmit ring buffer head index */
+    uint32_t volatile txRingBufTail;    /**< The transmit ring buffer tail index */
+
     void     *rxBuf;                    /**< The pointer to the receive buffer */
     uint32_t  rxBufSize;                /**< The receive buffer size */
     uint32_t volatile rxBufIdx;         /**< The current location in the receive buffer */
@@ -600,6 +622,16 @@ void     Cy_SCB_UART_StartRingBuffer   (CySCB_Type *base, void *buffer, uint32_t
 void     Cy_SCB_UART_StopRingBuffer    (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 uint32_t Cy_SCB_UART_GetNumInRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context_t const *context);
 void     Cy_SCB_UART_ClearRingBuffer   (CySCB_Type const *base, cy_stc_scb_uart_context_t *context);
+uint32_t Cy_SCB_UART_GetRingBufferReadSpan(CySCB_Type const *base, void **span,
+                                           cy_stc_scb_uart_context_t const *context);
+void     Cy_SCB_UART_CommitRingBufferRead (CySCB_Type *base, uint32_t size, cy_stc_scb_uart_context_t *context);
+
+void     Cy_SCB_UART_StartTxRingBuffer   (CySCB_Type *base, void *buffer, uint32_t size,
+                                          cy_stc_scb_uart_context_t *context);
+void     Cy_SCB_UART_StopTxRingBuffer    (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
+uint32_t Cy_SCB_UART_GetNumInTxRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context_t const *context);
+uint32_t Cy_SCB_UART_PutTxRingBuffer     (CySCB_Type *base, void const *buffer, uint32_t size,
+                                          cy_stc_scb_uart_context_t *context);
 
 cy_en_scb_uart_status_t Cy_SCB_UART_Receive(CySCB_Type *base, void *buffer, uint32_t size,
                                             cy_stc_scb_uart_context_t *context);
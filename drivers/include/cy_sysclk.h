@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_sysclk.h
-* \version 1.0
+* \version 1.10
 *
 * Provides an API declaration of the sysclk driver.
 *
@@ -112,6 +112,27 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="3">1.10</td>
+*     <td>Added \ref CY_SYSCLK_PLL_MANUAL_CONFIG and \ref CY_SYSCLK_PLL_IS_EXACT
+*         to calculate the PLL parameters at build time.
+*         \ref Cy_SysClk_PllConfigure calculates the parameters directly
+*         for the input and output frequencies that are multiples of 1 MHz.</td>
+*     <td>Reduced the PLL configuration time.</td>
+*   </tr>
+*   <tr>
+*     <td>Added \ref Cy_SysClk_EcoManualConfigure, \ref CY_SYSCLK_ECO_MANUAL_CONFIG
+*         and \ref CY_SYSCLK_ECO_IS_CONFIG_VALID to calculate the ECO trim
+*         values at build time.</td>
+*     <td>Removed the square root and divisions from the ECO configuration
+*         when the crystal characteristics are known at build time.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the background ILO calibration: \ref Cy_SysClk_IloCalInit,
+*         \ref Cy_SysClk_IloCalProcess, \ref Cy_SysClk_IloCalGetFreq,
+*         \ref Cy_SysClk_IloCyclesToUs and \ref Cy_SysClk_IloUsToCycles.</td>
+*     <td>The ILO cycles and time conversion without waiting for a measurement.</td>
+*   </tr>
+*   <tr>
 *     <td>1.0</td>
 *     <td>Initial version</td>
 *     <td></td>
@@ -160,7 +181,15 @@
 *   connected to this crystal must be configured to operate in analog
 *   drive mode with HSIOM connection set to GPIO control (HSIOM_SEL_GPIO).
 *
+*   The ECO trim values can be calculated at run time from the crystal
+*   characteristics by \ref Cy_SysClk_EcoConfigure, or at build time by the
+*   \ref CY_SYSCLK_ECO_MANUAL_CONFIG macro. In the latter case,
+*   \ref Cy_SysClk_EcoManualConfigure only writes the pre-calculated values
+*   into the registers, so no square root or division is executed by the CPU.
+*
 *   \defgroup group_sysclk_eco_funcs       Functions
+*   \defgroup group_sysclk_eco_macros      Macros
+*   \defgroup group_sysclk_eco_structs     Data Structures
 *   \defgroup group_sysclk_eco_enums       Enumerated Types
 * \}
 * \defgroup group_sysclk_pll             Phase Locked Loop (PLL)
@@ -185,7 +214,15 @@
 *   This method is faster but requires prior knowledge of the necessary parameters.
 *   Consult the device TRM for the PLL calculation equations.
 *
+*   When the input and output frequencies are integer multiples of 1 MHz, the
+*   parameter values can be calculated at build time by the
+*   \ref CY_SYSCLK_PLL_MANUAL_CONFIG macro (check the frequencies with
+*   \ref CY_SYSCLK_PLL_IS_EXACT). \ref Cy_SysClk_PllConfigure uses the same
+*   calculation for such frequencies and searches for the parameters only
+*   for the other frequencies.
+*
 *   \defgroup group_sysclk_pll_funcs       Functions
+*   \defgroup group_sysclk_pll_macros      Macros
 *   \defgroup group_sysclk_pll_structs     Data Structures
 *   \defgroup group_sysclk_pll_enums       Enumerated Types
 * \}
@@ -199,6 +236,20 @@
 *   a higher precision clock source. Use the \ref group_sysclk_ilo_funcs API
 *   to measure the current ILO frequency and trim it.
 *
+*   The background calibration keeps a filtered estimate of the ILO frequency.
+*   Call \ref Cy_SysClk_IloCalProcess periodically, for example from the main
+*   loop or a timer callback. Every \ref CY_SYSCLK_ILO_CAL_INTERVAL calls (or
+*   the interval set by \ref Cy_SysClk_IloCalInit), a measurement of about
+*   1 ms is started; it completes in
+*   one of the following calls and updates the estimate by the exponential
+*   filter with the weight of 2^-\ref CY_SYSCLK_ILO_CAL_FILTER.
+*   \ref Cy_SysClk_IloCyclesToUs and \ref Cy_SysClk_IloUsToCycles use the
+*   conversion factors precalculated on every update, so they take constant
+*   time and can be used to schedule the WDT at any moment.
+*
+*   \note The background calibration and \ref Cy_SysClk_IloCompensate use the
+*   same measurement counters and must not be used at the same time.
+*
 *   \defgroup group_sysclk_ilo_funcs       Functions
 * \}
 * \defgroup group_sysclk_pm              Low Power Callback
@@ -329,7 +380,7 @@ extern "C" {
 /** Driver major version */
 #define  CY_SYSCLK_DRV_VERSION_MAJOR   1
 /** Driver minor version */
-#define  CY_SYSCLK_DRV_VERSION_MINOR   0
+#define  CY_SYSCLK_DRV_VERSION_MINOR   10
 /** Sysclk driver identifier */
 #define CY_SYSCLK_ID   CY_PDL_DRV_ID(0x12U)
 
@@ -337,6 +388,19 @@ extern "C" {
 #define CY_SYSCLK_ILO_FREQ  (40000UL)   /* Hz */
 /** WCO clock frequency */
 #define CY_SYSCLK_WCO_FREQ  (32768UL)   /* Hz */
+
+#if !defined(CY_SYSCLK_ILO_CAL_FILTER)
+/**
+* The ILO background calibration filter shift. Every measurement moves the
+* ILO frequency estimate by 1/2^CY_SYSCLK_ILO_CAL_FILTER of the difference.
+*/
+#define CY_SYSCLK_ILO_CAL_FILTER  (3UL)
+#endif
+
+#if !defined(CY_SYSCLK_ILO_CAL_INTERVAL)
+/** The default number of \ref Cy_SysClk_IloCalProcess calls between the ILO measurements */
+#define CY_SYSCLK_ILO_CAL_INTERVAL  (16UL)
+#endif
 /** \} group_sysclk_macros */
 
 /**
@@ -472,10 +536,118 @@ typedef enum
 } cy_en_sysclk_eco_stat_t;
 /** \} group_sysclk_eco_enums */
 
+/**
+* \addtogroup group_sysclk_eco_structs
+* \{
+*/
+/** Structure containing the pre-calculated ECO trim values, see \ref CY_SYSCLK_ECO_MANUAL_CONFIG */
+typedef struct
+{
+    uint32_t                       freq;   /**< Operating frequency of the crystal in Hz */
+    uint8_t                        wdTrim; /**< EXCO_ECO_TRIM0.WDTRIM bits */
+    uint8_t                        aTrim;  /**< EXCO_ECO_TRIM0.ATRIM bits */
+    uint8_t                        fTrim;  /**< EXCO_ECO_TRIM1.FTRIM bits, the RTRIM bits get the same value */
+    uint8_t                        gTrim;  /**< EXCO_ECO_TRIM1.GTRIM bits */
+    bool                           agcEn;  /**< EXCO_ECO_CONFIG.AGC_EN bit */
+} cy_stc_sysclk_eco_manual_config_t;
+/** \} group_sysclk_eco_structs */
+
 /** \cond */
 #define SRSS_CLK_ECO_STATUS_Msk (SRSS_CLK_ECO_STATUS_ECO_OK_Msk | SRSS_CLK_ECO_STATUS_ECO_READY_Msk)
+
+#define CY_SYSCLK_ECO_FREQ_MIN (4000000UL)  /* 4 MHz */
+#define CY_SYSCLK_ECO_FREQ_MAX (33000000UL) /* 33 MHz */
+#define CY_SYSCLK_ECO_CLD_MAX  (100UL)      /* 100 pF */
+#define CY_SYSCLK_ECO_ESR_MAX  (1000UL)     /* 1000 Ohm */
+#define CY_SYSCLK_ECO_DRV_MAX  (2000UL)     /* 2 mW */
+
+#define CY_SYSCLK_ECO_IS_FREQ_VALID(freq) ((CY_SYSCLK_ECO_FREQ_MIN <= (freq)) && ((freq) <= CY_SYSCLK_ECO_FREQ_MAX))
+#define CY_SYSCLK_ECO_IS_CLD_VALID(cld)   ((0UL < (cld)) && ((cld) <= CY_SYSCLK_ECO_CLD_MAX))
+#define CY_SYSCLK_ECO_IS_ESR_VALID(esr)   ((0UL < (esr)) && ((esr) <= CY_SYSCLK_ECO_ESR_MAX))
+#define CY_SYSCLK_ECO_IS_DRV_VALID(drv)   ((0UL < (drv)) && ((drv) <= CY_SYSCLK_ECO_DRV_MAX))
+
+/* The same intermediate values as Cy_SysClk_EcoConfigure calculates */
+#define CY_SYSCLK_ECO_FREQ_KHZ(freq)         CY_SYSLIB_DIV_ROUND((uint32_t)(freq), 1000UL)
+#define CY_SYSCLK_ECO_SQRT_ARG(esr, drv)     CY_SYSLIB_DIV_ROUND(2000000UL * (uint32_t)(drv), (uint32_t)(esr))
+#define CY_SYSCLK_ECO_AMP_SECT(freq, cLoad, esr) \
+    ((CY_SYSLIB_DIV_ROUND((uint32_t)(cLoad) * (uint32_t)(cLoad) * \
+      CY_SYSLIB_DIV_ROUND(CY_SYSCLK_ECO_FREQ_KHZ(freq) * CY_SYSCLK_ECO_FREQ_KHZ(freq), 56993UL), 1000UL) * \
+      (uint32_t)(esr)) / 1000000UL)
+
+/* The maxAmpl value (scaled by 10^3) is not less than ampl when the square root
+*  argument is not less than the square of the smallest root that gives ampl.
+*  So the square root itself is never calculated.
+*/
+#define CY_SYSCLK_ECO_AMPL_DIV(freq, cLoad)  ((uint64_t)CY_SYSCLK_ECO_FREQ_KHZ(freq) * (uint64_t)(cLoad))
+#define CY_SYSCLK_ECO_ROOT_MIN(freq, cLoad, ampl) \
+    CY_SYSLIB_DIV_ROUNDUP(((uint64_t)(ampl) * CY_SYSCLK_ECO_AMPL_DIV((freq), (cLoad))) - \
+                          (CY_SYSCLK_ECO_AMPL_DIV((freq), (cLoad)) / 2U), 159155U)
+#define CY_SYSCLK_ECO_AMPL_GE(freq, cLoad, esr, drv, ampl) \
+    ((uint64_t)CY_SYSCLK_ECO_SQRT_ARG((esr), (drv)) >= \
+     (CY_SYSCLK_ECO_ROOT_MIN((freq), (cLoad), (ampl)) * CY_SYSCLK_ECO_ROOT_MIN((freq), (cLoad), (ampl))))
+
+#define CY_SYSCLK_ECO_WDTRIM(freq, cLoad, esr, drv) \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv), 1000UL) ? 3U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv),  800UL) ? 2U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv),  600UL) ? 1U : 0U)))
+
+#define CY_SYSCLK_ECO_ATRIM(freq, cLoad, esr, drv) \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv), 1275UL) ? 7U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv), 1150UL) ? 6U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv), 1025UL) ? 5U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv),  900UL) ? 4U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv),  800UL) ? 3U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv),  700UL) ? 2U : \
+    (CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (drv),  600UL) ? 1U : 0U)))))))
+
+#define CY_SYSCLK_ECO_FTRIM(freq) \
+    (((uint32_t)(freq) > 30000000UL) ? 0U : \
+    (((uint32_t)(freq) > 24000000UL) ? 1U : \
+    (((uint32_t)(freq) > 17000000UL) ? 2U : 3U)))
+
+#define CY_SYSCLK_ECO_GTRIM(freq, cLoad, esr) \
+    ((CY_SYSCLK_ECO_AMP_SECT((freq), (cLoad), (esr)) > 1UL) ? CY_SYSCLK_ECO_AMP_SECT((freq), (cLoad), (esr)) : \
+    ((CY_SYSCLK_ECO_AMP_SECT((freq), (cLoad), (esr)) == 1UL) ? 0UL : 1UL))
 /** \endcond */
 
+/**
+* \addtogroup group_sysclk_eco_macros
+* \{
+*/
+
+/**
+* Checks whether \ref CY_SYSCLK_ECO_MANUAL_CONFIG can be used for the crystal
+* characteristics: the same parameter checks as \ref Cy_SysClk_EcoConfigure
+* does (see the parameter descriptions and the calculation formulas there).
+* Intended for the compile-time checks of the constant arguments.
+*/
+#define CY_SYSCLK_ECO_IS_CONFIG_VALID(freq, cLoad, esr, driveLevel) \
+    (CY_SYSCLK_ECO_IS_FREQ_VALID(freq)  && \
+     CY_SYSCLK_ECO_IS_CLD_VALID(cLoad)  && \
+     CY_SYSCLK_ECO_IS_ESR_VALID(esr)    && \
+     CY_SYSCLK_ECO_IS_DRV_VALID(driveLevel) && \
+     CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (driveLevel), 500UL) && \
+     (CY_SYSCLK_ECO_AMP_SECT((freq), (cLoad), (esr)) <= 3UL))
+
+/**
+* The initializer of \ref cy_stc_sysclk_eco_manual_config_t for the crystal
+* with the operating frequency freq (Hz), load capacitance cLoad (pF),
+* effective series resistance esr (Ohm) and drive level driveLevel (uW).
+* The trim values are the same as \ref Cy_SysClk_EcoConfigure calculates,
+* and they are calculated at build time when the arguments are constants.
+* Use only when \ref CY_SYSCLK_ECO_IS_CONFIG_VALID is true for the arguments.
+*/
+#define CY_SYSCLK_ECO_MANUAL_CONFIG(freq, cLoad, esr, driveLevel) \
+    {                                                                                 \
+        (uint32_t)(freq),                                                             \
+        (uint8_t) CY_SYSCLK_ECO_WDTRIM((freq), (cLoad), (esr), (driveLevel)),         \
+        (uint8_t) CY_SYSCLK_ECO_ATRIM((freq), (cLoad), (esr), (driveLevel)),          \
+        (uint8_t) CY_SYSCLK_ECO_FTRIM(freq),                                          \
+        (uint8_t) CY_SYSCLK_ECO_GTRIM((freq), (cLoad), (esr)),                        \
+        !CY_SYSCLK_ECO_AMPL_GE((freq), (cLoad), (esr), (driveLevel), 2000UL)          \
+    }
+/** \} group_sysclk_eco_macros */
+
 
 
 /**
@@ -483,6 +655,7 @@ typedef enum
 * \{
 */
 cy_en_sysclk_status_t Cy_SysClk_EcoConfigure(uint32_t freq, uint32_t cLoad, uint32_t esr, uint32_t driveLevel);
+cy_en_sysclk_status_t Cy_SysClk_EcoManualConfigure(const cy_stc_sysclk_eco_manual_config_t * config);
 cy_en_sysclk_status_t Cy_SysClk_EcoEnable(uint32_t timeoutUs);
              uint32_t Cy_SysClk_EcoGetFrequency(void);
  __STATIC_INLINE bool Cy_SysClk_EcoIsEnabled(void);
@@ -654,8 +827,83 @@ typedef struct
 /** \cond */
 #define CY_SYSCLK_IS_PLL_ICP_LT67MHZ (2U) /* PLL Fout <= 67MHz*/
 #define CY_SYSCLK_IS_PLL_ICP_GT67MHZ (3U) /* PLL Fout >  67MHz*/
+
+/* Internal PLL frequencies ranges */
+#define CY_SYSCLK_PLL_MIN_FVCO      (22500000UL)
+#define CY_SYSCLK_PLL_MAX_FVCO      (104000000UL)
+#define CY_SYSCLK_PLL_MAX_FPFD      (3000000UL)
+#define CY_SYSCLK_PLL_FREQ_STEP     (1000000UL)
+
+/* Checks whether the frequency is a multiple of the PLL PFD frequency */
+#define CY_SYSCLK_PLL_IS_FPFD_MUL(freq, fpfd)   (0UL == ((uint32_t)(freq) % (fpfd)))
 /** \endcond */
 
+/**
+* \addtogroup group_sysclk_pll_macros
+* \{
+*/
+
+/**
+* Returns the OUTPUT_DIV value: the smallest output divider that makes the
+* VCO frequency not lower than its minimum for the PLL output frequency outHz.
+*/
+#define CY_SYSCLK_PLL_OUT_DIV(outHz) \
+    (((uint32_t)(outHz) >= CY_SYSCLK_PLL_MIN_FVCO) ? 0UL : \
+    ((((uint32_t)(outHz) << 1UL) >= CY_SYSCLK_PLL_MIN_FVCO) ? 1UL : \
+    ((((uint32_t)(outHz) << 2UL) >= CY_SYSCLK_PLL_MIN_FVCO) ? 2UL : 3UL)))
+
+/** Returns the VCO frequency in Hz for the PLL output frequency outHz */
+#define CY_SYSCLK_PLL_FVCO(outHz)   ((uint32_t)(outHz) << CY_SYSCLK_PLL_OUT_DIV(outHz))
+
+/**
+* Returns the highest PFD frequency (3, 2 or 1 MHz) that both the input
+* frequency inHz and the VCO frequency are multiples of.
+*/
+#define CY_SYSCLK_PLL_FPFD(inHz, outHz) \
+    ((CY_SYSCLK_PLL_IS_FPFD_MUL((inHz), 3000000UL) && \
+      CY_SYSCLK_PLL_IS_FPFD_MUL(CY_SYSCLK_PLL_FVCO(outHz), 3000000UL)) ? 3000000UL : \
+    ((CY_SYSCLK_PLL_IS_FPFD_MUL((inHz), 2000000UL) && \
+      CY_SYSCLK_PLL_IS_FPFD_MUL(CY_SYSCLK_PLL_FVCO(outHz), 2000000UL)) ? 2000000UL : 1000000UL))
+
+/** Returns the REFERENCE_DIV (Q) value for the inHz to outHz conversion */
+#define CY_SYSCLK_PLL_REF_DIV(inHz, outHz)  (((uint32_t)(inHz) / CY_SYSCLK_PLL_FPFD((inHz), (outHz))) - 1UL)
+
+/** Returns the FEEDBACK_DIV (P) value for the inHz to outHz conversion */
+#define CY_SYSCLK_PLL_FB_DIV(inHz, outHz)   (CY_SYSCLK_PLL_FVCO(outHz) / CY_SYSCLK_PLL_FPFD((inHz), (outHz)))
+
+/**
+* Checks whether \ref CY_SYSCLK_PLL_MANUAL_CONFIG produces the exact output
+* frequency outHz from the input frequency inHz: both frequencies must be
+* multiples of 1 MHz and the resulting dividers must be in the valid ranges.
+* The input and output frequency limits are the same as for
+* \ref Cy_SysClk_PllConfigure.
+*/
+#define CY_SYSCLK_PLL_IS_EXACT(inHz, outHz) \
+    (CY_SYSCLK_PLL_IS_FPFD_MUL((inHz), CY_SYSCLK_PLL_FREQ_STEP)  && \
+     CY_SYSCLK_PLL_IS_FPFD_MUL((outHz), CY_SYSCLK_PLL_FREQ_STEP) && \
+     ((uint32_t)(inHz) >= CY_SYSCLK_PLL_FREQ_STEP)                && \
+     (CY_SYSCLK_PLL_FVCO(outHz) <= CY_SYSCLK_PLL_MAX_FVCO)         && \
+     (CY_SYSCLK_PLL_REF_DIV((inHz), (outHz)) <= 0x3FUL)            && \
+     (CY_SYSCLK_PLL_FB_DIV((inHz), (outHz)) >= 8UL)                && \
+     (CY_SYSCLK_PLL_FB_DIV((inHz), (outHz)) <= 255UL))
+
+/**
+* The initializer of \ref cy_stc_sysclk_pll_manual_config_t for the PLL that
+* converts the input frequency inHz into the output frequency outHz.
+* The values are calculated at build time when the arguments are constants.
+* Use only when \ref CY_SYSCLK_PLL_IS_EXACT is true for the arguments.
+*
+* \snippet sysclk/snippet/main.c snippet_Cy_SysClk_PllManualConfigure
+*/
+#define CY_SYSCLK_PLL_MANUAL_CONFIG(inHz, outHz) \
+    {                                                               \
+        (uint8_t) CY_SYSCLK_PLL_FB_DIV((inHz), (outHz)),           \
+        (uint8_t) CY_SYSCLK_PLL_REF_DIV((inHz), (outHz)),          \
+        (uint8_t) CY_SYSCLK_PLL_OUT_DIV(outHz),                    \
+        CY_SYSCLK_IS_PLL_ICP_LT67MHZ                               \
+    }
+/** \} group_sysclk_pll_macros */
+
 /**
 * \addtogroup group_sysclk_pll_funcs
 * \{
@@ -900,6 +1148,11 @@ __STATIC_INLINE cy_en_sysclk_status_t Cy_SysClk_IloDisable(void);
                  void Cy_SysClk_IloStartMeasurement(void);
                  void Cy_SysClk_IloStopMeasurement(void);
 cy_en_sysclk_status_t Cy_SysClk_IloCompensate(uint32_t desiredDelay , uint32_t * compensatedCycles);
+                 void Cy_SysClk_IloCalInit(uint32_t interval);
+cy_en_sysclk_status_t Cy_SysClk_IloCalProcess(void);
+             uint32_t Cy_SysClk_IloCalGetFreq(void);
+             uint32_t Cy_SysClk_IloCyclesToUs(uint32_t cycles);
+             uint32_t Cy_SysClk_IloUsToCycles(uint32_t us);
 
 
 /*******************************************************************************
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_sysint.h
-* \version 1.0
+* \version 1.10
 *
 * \brief
 * Provides an API declaration of the SysInt driver
@@ -60,6 +60,50 @@
 * Using this method avoids the need for a RAM vector table. However in this scenario,
 * interrupt handler re-location at run-time is not possible, unless the vector table is
 * relocated to RAM.
+*
+* \subsection group_sysint_dispatch Binding Driver Instances to Vectors
+* Driver interrupt functions such as Cy_SCB_UART_Interrupt() take the
+* peripheral base address and a driver context as arguments. The usual
+* approach wraps the call in a one-line user ISR. The \ref CY_SYSINT_DISPATCH
+* macro is a convenience that generates this wrapper, binding the ISR to a
+* peripheral instance and context at compile time. The generated code is the
+* same as the hand-written wrapper. Naming the handler
+* \<interrupt_name\>_IRQHandler places it in the flash vector table:
+* \code
+* static cy_stc_scb_uart_context_t uartContext;
+*
+* CY_SYSINT_DISPATCH(scb_0_interrupt_IRQHandler, Cy_SCB_UART_Interrupt, SCB0, &uartContext)
+* \endcode
+* The generated handler can also be passed to Cy_SysInt_Init() when the RAM
+* vector table is used. See \ref CY_TCPWM_DISPATCH for the TCPWM counterpart.
+*
+* \subsection group_sysint_profile Interrupt Profiler
+* Setting \ref CY_SYSINT_PROFILE to 1 enables an optional profiler that
+* measures interrupt service routine duration and the time interrupts are
+* blocked by critical sections. Timestamps are taken from a free-running TCPWM
+* counter that the application configures (period 0xFFFF, continuous mode) and
+* passes to Cy_SysInt_ProfileInit(). Durations are in counter clocks.
+*
+* An ISR is profiled by wrapping its body between Cy_SysInt_ProfileIsrEnter()
+* and Cy_SysInt_ProfileIsrExit(), or by generating it with
+* \ref CY_SYSINT_PROFILE_DISPATCH. The statistics are kept per interrupt
+* number, which Cy_SysInt_ProfileIsrExit() reads from the IPSR register.
+* While the profiler is enabled, Cy_SysLib_EnterCriticalSection() and
+* Cy_SysLib_ExitCriticalSection() are redirected to
+* Cy_SysInt_ProfileEnterCritical() and Cy_SysInt_ProfileExitCritical(), so the
+* critical sections of the PDL drivers and of the application are measured.
+* Only the outermost section of a nested set is recorded. Define
+* \ref CY_SYSINT_PROFILE for the whole project, for example on the compiler
+* command line, so that every source file sees the redirection.
+*
+* Each statistics entry (\ref cy_stc_sysint_profile_t) holds the minimum,
+* maximum and number of samples, and a histogram of
+* \ref CY_SYSINT_PROFILE_HIST_BINS bins each 2^\ref CY_SYSINT_PROFILE_HIST_SHIFT
+* counter clocks wide. The last bin also collects all longer samples.
+* The entries are plain RAM structures, so a debugger can read them directly.
+*
+* \note The ISR duration includes the time spent in higher-priority interrupts
+* that preempted it, and the call overhead of the profiler functions.
 
 * \section group_sysint_driver_usage Driver Usage
 *
@@ -159,6 +203,17 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="2">1.10</td>
+*     <td>Added the \ref CY_SYSINT_DISPATCH macro.</td>
+*     <td>Convenience macro for the driver interrupt handlers bound to a
+*         peripheral instance and context at compile time.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the optional interrupt and critical section profiler
+*         (\ref group_sysint_profile).</td>
+*     <td>Measurement of ISR duration and interrupt blocking time.</td>
+*   </tr>
+*   <tr>
 *     <td>1.0</td>
 *     <td>Initial version</td>
 *     <td></td>
@@ -214,11 +269,82 @@ extern cy_israddress __RAM_VECTOR_TABLE[CY_VECTOR_TABLE_SIZE];   /**< Relocated
 #define CY_SYSINT_DRV_VERSION_MAJOR    1
 
 /** Driver minor version */
-#define CY_SYSINT_DRV_VERSION_MINOR    0
+#define CY_SYSINT_DRV_VERSION_MINOR    10
 
 /** SysInt driver ID */
 #define CY_SYSINT_ID CY_PDL_DRV_ID     (0x15U)
 
+/**
+* Defines an interrupt handler that calls a driver interrupt function with a
+* fixed peripheral instance and context.
+*
+* \param handler
+* The name of the generated handler. Use \<interrupt_name\>_IRQHandler to
+* place it in the flash vector table.
+*
+* \param isr
+* The driver interrupt function, for example Cy_SCB_UART_Interrupt. It must
+* take the base address and the context pointer as its two arguments.
+*
+* \param base
+* The peripheral base address, for example SCB0.
+*
+* \param context
+* The address of the driver context structure.
+*/
+#define CY_SYSINT_DISPATCH(handler, isr, base, context) \
+    void handler(void); \
+    void handler(void) \
+    { \
+        isr((base), (context)); \
+    }
+
+#if !defined(CY_SYSINT_PROFILE)
+    /** Enables the interrupt and critical section profiler */
+    #define CY_SYSINT_PROFILE               (0U)
+#endif /* !defined(CY_SYSINT_PROFILE) */
+
+#if !defined(CY_SYSINT_PROFILE_IRQ_NUM)
+    /** The number of interrupts, starting from 0, with profiler statistics */
+    #define CY_SYSINT_PROFILE_IRQ_NUM       (32UL)
+#endif /* !defined(CY_SYSINT_PROFILE_IRQ_NUM) */
+
+#if !defined(CY_SYSINT_PROFILE_HIST_BINS)
+    /** The number of histogram bins of a profiler statistics entry */
+    #define CY_SYSINT_PROFILE_HIST_BINS     (8UL)
+#endif /* !defined(CY_SYSINT_PROFILE_HIST_BINS) */
+
+#if !defined(CY_SYSINT_PROFILE_HIST_SHIFT)
+    /** The histogram bin width, as a power of two of the counter clocks */
+    #define CY_SYSINT_PROFILE_HIST_SHIFT    (3UL)
+#endif /* !defined(CY_SYSINT_PROFILE_HIST_SHIFT) */
+
+/**
+* Defines an interrupt handler like \ref CY_SYSINT_DISPATCH and records the
+* duration of the driver interrupt function with the profiler.
+* Available when \ref CY_SYSINT_PROFILE is enabled.
+*
+* \param handler
+* The name of the generated handler.
+*
+* \param isr
+* The driver interrupt function.
+*
+* \param base
+* The peripheral base address.
+*
+* \param context
+* The address of the driver context structure.
+*/
+#define CY_SYSINT_PROFILE_DISPATCH(handler, isr, base, context) \
+    void handler(void); \
+    void handler(void) \
+    { \
+        uint32_t isrStart = Cy_SysInt_ProfileIsrEnter(); \
+        isr((base), (context)); \
+        Cy_SysInt_ProfileIsrExit(isrStart); \
+    }
+
 /** \} group_sysint_macros */
 
 
@@ -269,6 +395,14 @@ typedef struct {
     uint32_t        intrPriority;   /**< Interrupt priority number (Refer to __NVIC_PRIO_BITS) */
 } cy_stc_sysint_t;
 
+/** Profiler statistics of one interrupt or of the critical sections */
+typedef struct {
+    uint16_t        min;            /**< Shortest duration, in counter clocks */
+    uint16_t        max;            /**< Longest duration, in counter clocks */
+    uint32_t        count;          /**< Number of recorded samples */
+    uint16_t        hist[CY_SYSINT_PROFILE_HIST_BINS]; /**< Saturating sample count per duration bin */
+} cy_stc_sysint_profile_t;
+
 /** \} group_sysint_data_structures */
 
 
@@ -300,6 +434,17 @@ cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t* config, cy_israddres
 cy_israddress Cy_SysInt_SetVector(IRQn_Type IRQn, cy_israddress userIsr);
 cy_israddress Cy_SysInt_GetVector(IRQn_Type IRQn);
 
+#if (CY_SYSINT_PROFILE != 0U) && defined(CY_IP_M0S8TCPWM)
+void Cy_SysInt_ProfileInit(TCPWM_Type const *base, uint32_t cntNum);
+void Cy_SysInt_ProfileReset(void);
+uint32_t Cy_SysInt_ProfileIsrEnter(void);
+void Cy_SysInt_ProfileIsrExit(uint32_t start);
+uint32_t Cy_SysInt_ProfileEnterCritical(void);
+void Cy_SysInt_ProfileExitCritical(uint32_t savedIntrStatus);
+const cy_stc_sysint_profile_t * Cy_SysInt_ProfileGetIsrStats(IRQn_Type IRQn);
+const cy_stc_sysint_profile_t * Cy_SysInt_ProfileGetCriticalStats(void);
+#endif /* (CY_SYSINT_PROFILE != 0U) && defined(CY_IP_M0S8TCPWM) */
+
 /** \} group_sysint_functions */
 
 #if defined(__cplusplus)
@@ -436,6 +436,22 @@ uint32_t Cy_SysLib_EnterCriticalSection(void);
 *******************************************************************************/
 void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
 
+/** \cond INTERNAL */
+#if defined(CY_SYSINT_PROFILE) && defined(CY_IP_M0S8TCPWM)
+#if (CY_SYSINT_PROFILE != 0U)
+    /* Route the PDL critical sections through the SysInt profiler. The
+    * profiler calls the SysLib functions as (Cy_SysLib_EnterCriticalSection)()
+    * to bypass these macros.
+    */
+    uint32_t Cy_SysInt_ProfileEnterCritical(void);
+    void Cy_SysInt_ProfileExitCritical(uint32_t savedIntrStatus);
+
+    #define Cy_SysLib_EnterCriticalSection()                Cy_SysInt_ProfileEnterCritical()
+    #define Cy_SysLib_ExitCriticalSection(savedIntrStatus)  Cy_SysInt_ProfileExitCritical(savedIntrStatus)
+#endif /* (CY_SYSINT_PROFILE != 0U) */
+#endif /* defined(CY_SYSINT_PROFILE) && defined(CY_IP_M0S8TCPWM) */
+/** \endcond */
+
 /** \} group_syslib_functions */
 
 /** \cond */
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_syspm.h
-* \version 1.0
+* \version 1.10
 *
 * Provides the function definitions for the power management API.
 *
@@ -76,6 +76,66 @@
 * </table>
 * \endif
 *
+* \section group_syspm_changelog Changelog
+* <table class="doxtable">
+*   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
+*   <tr>
+*     <td rowspan="2">1.10</td>
+*     <td>Added the optional callback table rebuilt on the callback
+*         registration and the optional callback execution time measurement, see
+*         \ref group_syspm_callback_table.</td>
+*     <td>Reduced the callback execution overhead of the power mode transitions.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the static callbacks placed in flash by the linker, see
+*         \ref group_syspm_static_callbacks.</td>
+*     <td>Removed the callback registration from the device startup and
+*         reduced the RAM consumption.</td>
+*   </tr>
+*   <tr>
+*     <td>1.0</td>
+*     <td>Initial version</td>
+*     <td></td>
+*   </tr>
+* </table>
+*
+* \section group_syspm_callback_table Callback Table
+* The registered callbacks of the CY_SYSPM_SLEEP and CY_SYSPM_DEEPSLEEP types
+* are stored in the callback lists ordered by the \ref cy_stc_syspm_callback_t
+* order element. When \ref CY_SYSPM_CALLBACK_TABLE is defined as 1 in the
+* project, \ref Cy_SysPm_RegisterCallback and
+* \ref Cy_SysPm_UnregisterCallback rebuild a table holding, for each callback
+* mode, only the callbacks that are not skipped in this mode, in the execution
+* order. The power mode transition functions execute the callbacks from this
+* table, so the callback lists and the skipMode masks are not checked during
+* the transitions. The table size is defined by
+* \ref CY_SYSPM_CALLBACK_TABLE_SIZE. When it is too small for the registered
+* callbacks, the callbacks are executed by walking the callback list.
+* The table is disabled by default: it takes about 290 bytes of RAM with the
+* default size, which matters on the devices with 2-4 KB of SRAM.
+*
+* When \ref CY_SYSPM_CALLBACK_PROFILING is enabled, the execution time of each
+* callback in each mode is measured by the SysTick timer and can be read by
+* \ref Cy_SysPm_GetCallbackCycles. This allows finding the callbacks that
+* dominate the power mode transition time.
+*
+* \section group_syspm_static_callbacks Static Callbacks
+* The callbacks known at build time can be declared by the
+* \ref CY_SYSPM_STATIC_CALLBACK macro instead of calling
+* \ref Cy_SysPm_RegisterCallback. The declared callbacks are constant
+* structures placed into the dedicated linker sections. The linker collects
+* them into one table in flash, sorted by the execution order encoded in the
+* section names. The linker scripts provided in devices/templates/COMPONENT_MTB
+* define this table for all supported toolchains. Define
+* \ref CY_SYSPM_STATIC_CALLBACKS as 1 in the project to execute the static
+* callbacks, otherwise the driver does not reference the table.
+*
+* The static callbacks are executed before the registered callbacks in the
+* CY_SYSPM_CHECK_READY and CY_SYSPM_BEFORE_TRANSITION modes, and after them in
+* the CY_SYSPM_CHECK_FAIL and CY_SYSPM_AFTER_TRANSITION modes. If a static
+* callback fails in the CY_SYSPM_CHECK_READY mode, it is reported by
+* \ref Cy_SysPm_GetFailedStaticCallback.
+*
 * \defgroup group_syspm_macros Macros
 * \defgroup group_syspm_functions Functions
 * \{
@@ -113,11 +173,55 @@ extern "C" {
 #define CY_SYSPM_DRV_VERSION_MAJOR       1
 
 /** Driver minor version */
-#define CY_SYSPM_DRV_VERSION_MINOR       0
+#define CY_SYSPM_DRV_VERSION_MINOR       10
 
 /** SysPm driver identifier */
 #define CY_SYSPM_ID                      (CY_PDL_DRV_ID(0x10U))
 
+#if !defined (CY_SYSPM_CALLBACK_TABLE)
+/**
+* Define this macro as 1 in the project to execute the CY_SYSPM_SLEEP and
+* CY_SYSPM_DEEPSLEEP callbacks from the callback table, see
+* \ref group_syspm_callback_table. The table takes RAM in proportion to
+* \ref CY_SYSPM_CALLBACK_TABLE_SIZE.
+*/
+#define CY_SYSPM_CALLBACK_TABLE          (0U)
+#endif /* !defined (CY_SYSPM_CALLBACK_TABLE) */
+
+#if !defined (CY_SYSPM_CALLBACK_TABLE_SIZE)
+/**
+* The maximum number of the CY_SYSPM_SLEEP or CY_SYSPM_DEEPSLEEP callbacks that
+* are executed in one mode from the callback table. If more callbacks are
+* registered, the callback list is walked instead. Define this macro in the
+* project to change the table size. Range: 1-255.
+*/
+#define CY_SYSPM_CALLBACK_TABLE_SIZE     (8U)
+#endif /* !defined (CY_SYSPM_CALLBACK_TABLE_SIZE) */
+
+#if !defined (CY_SYSPM_CALLBACK_PROFILING)
+/**
+* Define this macro as 1 in the project to measure the execution time of the
+* callbacks executed from the callback table,
+* see \ref Cy_SysPm_GetCallbackCycles. Requires \ref CY_SYSPM_CALLBACK_TABLE.
+*/
+#define CY_SYSPM_CALLBACK_PROFILING      (0U)
+#endif /* !defined (CY_SYSPM_CALLBACK_PROFILING) */
+
+/** \cond INTERNAL */
+#if (CY_SYSPM_CALLBACK_PROFILING != 0U) && (CY_SYSPM_CALLBACK_TABLE == 0U)
+    #error "CY_SYSPM_CALLBACK_PROFILING requires CY_SYSPM_CALLBACK_TABLE"
+#endif
+/** \endcond */
+
+#if !defined (CY_SYSPM_STATIC_CALLBACKS)
+/**
+* Define this macro as 1 in the project to execute the callbacks declared
+* by \ref CY_SYSPM_STATIC_CALLBACK. The linker script must define the
+* static callback table, see \ref group_syspm_static_callbacks.
+*/
+#define CY_SYSPM_STATIC_CALLBACKS        (0U)
+#endif /* !defined (CY_SYSPM_STATIC_CALLBACKS) */
+
 
 /*******************************************************************************
 *       Internal Defines
@@ -227,6 +331,35 @@ typedef enum
 #define CY_SYSPM_SKIP_BEFORE_TRANSITION             (0x04U)   /**< Define to skip before transition mode in the syspm callback */
 #define CY_SYSPM_SKIP_AFTER_TRANSITION              (0x08U)   /**< Define to skip after transition mode in the syspm callback */
 /** \} group_syspm_skip_callback_modes */
+
+/**
+* Declares a static SysPm callback, see \ref group_syspm_static_callbacks.
+*
+* \param name
+* The name of the \ref cy_stc_syspm_static_callback_t structure to define.
+*
+* \param order
+* The callback execution order: three decimal digits, 000-255. The callbacks
+* with lower order values are executed first while entering the low power
+* mode. The order is only used to name the linker section, so it must be
+* written with the leading zeros, for example 010.
+*
+* \param type
+* The callback type, see \ref cy_en_syspm_callback_type_t.
+*
+* \param skipMode
+* The mask of modes to be skipped, see \ref group_syspm_skip_callback_modes.
+*
+* \param callback
+* The callback handler function.
+*
+* \param params
+* The address of a \ref cy_stc_syspm_callback_params_t, the callback is
+* executed with these parameters.
+*/
+#define CY_SYSPM_STATIC_CALLBACK(name, order, type, skipMode, callback, params) \
+    CY_SECTION(".cy_syspm_callbacks." #order) CY_USED \
+    const cy_stc_syspm_static_callback_t name = {(callback), (type), (skipMode), (params)}
 /** \} group_syspm_macros */
 
 /**
@@ -283,6 +416,17 @@ typedef struct cy_stc_syspm_callback
                                                             order they are registered in the application. */
 } cy_stc_syspm_callback_t;
 
+/** Structure with static syspm callback configuration elements, see \ref CY_SYSPM_STATIC_CALLBACK */
+typedef struct
+{
+    Cy_SysPmCallback callback;                         /**< The callback handler function. */
+    cy_en_syspm_callback_type_t type;                  /**< The callback type, see \ref cy_en_syspm_callback_type_t. */
+    uint32_t skipMode;                                 /**< The mask of modes to be skipped during callback
+                                                            execution, see \ref group_syspm_skip_callback_modes. */
+    cy_stc_syspm_callback_params_t *callbackParams;    /**< The address of a cy_stc_syspm_callback_params_t,
+                                                            the callback is executed with these parameters. */
+} cy_stc_syspm_static_callback_t;
+
 /** \} group_syspm_data_structures */
 
 /**
@@ -316,6 +460,12 @@ bool Cy_SysPm_UnregisterCallback(cy_stc_syspm_callback_t const *handler);
 cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type, cy_en_syspm_callback_mode_t mode);
 cy_stc_syspm_callback_t* Cy_SysPm_GetFailedCallback(cy_en_syspm_callback_type_t type);
 /** \endcond */
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+cy_stc_syspm_static_callback_t const * Cy_SysPm_GetFailedStaticCallback(cy_en_syspm_callback_type_t type);
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+#if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+uint32_t Cy_SysPm_GetCallbackCycles(cy_stc_syspm_callback_t const *handler, cy_en_syspm_callback_mode_t mode);
+#endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
 /** \} group_syspm_functions_callback */
 
 /** \cond INTERNAL */
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_systick.h
-* \version 1.0
+* \version 1.10
 *
 * Provides the API declarations of the SysTick driver.
 *
@@ -58,6 +58,108 @@
 * interrupt interval and therefore \ref Cy_SysTick_SetReload() should be called
 * to compensate for this change.
 *
+* \section group_systick_clock Monotonic Clock
+*
+* The driver counts the SysTick interrupts in a 64-bit counter. It is returned
+* by \ref Cy_SysTick_GetTicks(). \ref Cy_SysTick_GetCycles() combines the
+* counter with the current SysTick counter value to get the number of the
+* SysTick clock cycles elapsed since \ref Cy_SysTick_Init() with a single cycle
+* resolution. \ref Cy_SysTick_GetTimeUs() converts it to microseconds. The
+* reload value must not be changed after \ref Cy_SysTick_Init() for the cycle
+* count to be valid.
+*
+* \section group_systick_delay Delays and Timeouts
+*
+* \ref Cy_SysTick_DelayUs() and the timeout functions
+* \ref Cy_SysTick_TimeoutStart() and \ref Cy_SysTick_TimeoutExpired() compare
+* \ref Cy_SysTick_GetCycles() against a deadline instead of counting CPU
+* cycles like \ref Cy_SysLib_DelayUs(). Time spent in interrupts is therefore
+* included in the delay rather than added to it. With the sleep option, the
+* CPU enters Sleep until the last SysTick period before the deadline and spins
+* only for the rest.
+*
+* The SysTick interrupt advances the cycle count, so these functions need the
+* SysTick initialized by \ref Cy_SysTick_Init() with its interrupt enabled and
+* able to preempt the caller. \ref Cy_SysTick_IsTimeBaseRunning() checks this.
+* When it returns false, for example inside a critical section or in an
+* interrupt of the same or higher priority, \ref Cy_SysTick_DelayUs() falls back
+* to \ref Cy_SysLib_DelayUs().
+*
+* The microseconds are converted to the SysTick clock cycles when the delay or
+* timeout is started. With the low frequency clock source, the delays do not
+* depend on the CPU clock and stay valid across the System clock changes. With
+* the CPU clock source, the SystemCoreClock value at the start is used and the
+* System clock must not change until the deadline.
+*
+* \code
+* cy_stc_systick_timeout_t timeout;
+*
+* Cy_SysTick_TimeoutStart(&timeout, 500UL);
+* while (!IsReady() && !Cy_SysTick_TimeoutExpired(&timeout))
+* {
+* }
+* \endcode
+*
+* \section group_systick_timers Software Timers
+*
+* Set \ref CY_SYSTICK_TIMER_WHEEL to 1 to enable the software timers. The
+* timers are kept in a hierarchical timer wheel of
+* \ref CY_SYSTICK_TIMER_WHEEL_LEVELS levels with 2^\ref CY_SYSTICK_TIMER_WHEEL_BITS
+* slots each. \ref Cy_SysTick_TimerStart() and \ref Cy_SysTick_TimerStop()
+* take constant time regardless of the number of the timers. The SysTick
+* interrupt processes only the timers of the current slot instead of checking
+* every timer on every tick. A timer can be one-shot or periodic. The timer
+* callback is executed in the SysTick interrupt context.
+*
+* The timer structures are allocated by the application and must stay valid
+* while the timer is running:
+*
+* \code
+* static cy_stc_systick_timer_t ledTimer;
+*
+* Cy_SysTick_TimerInit(&ledTimer, &LedToggle, NULL);
+* Cy_SysTick_TimerStart(&ledTimer, 500UL, 500UL);
+* \endcode
+*
+* \section group_systick_tickless Tickless Idle
+*
+* \ref Cy_SysTick_TicklessIdle() is called from the application idle loop
+* instead of the plain CPU Sleep. When the next software timer deadline is at
+* least \ref CY_SYSTICK_TICKLESS_MIN_TICKS ticks away, the WDT match is
+* programmed to the deadline and the device enters Deep Sleep by
+* \ref Cy_SysPm_SystemEnterDeepSleep(). The SysTick is stopped only when the
+* transition is committed, by an internal CY_SYSPM_DEEPSLEEP callback of order
+* 255 that is registered on the first Deep Sleep entry. The SysPm callbacks
+* with lower order values therefore see the time passing, and a failed
+* transition does not touch the SysTick. On wakeup, the same callback adds the
+* time spent in Deep Sleep, measured by the WDT counter, to the SysTick
+* counter, and the SysTick interrupt advances the monotonic clock and the
+* timer wheel over the slept ticks in one pass. Otherwise the CPU enters Sleep
+* with the SysTick running. The interrupts are masked only while the Deep Sleep
+* is set up, so the SysPm callbacks and the timer callbacks run with the
+* interrupts enabled, the latter in the SysTick interrupt context.
+*
+* \note The interrupt handlers that run on wakeup before the
+* CY_SYSPM_AFTER_TRANSITION callbacks see the SysTick stopped at the Deep Sleep
+* entry.
+*
+* The WDT cycles are converted using the ILO frequency estimate of the SysClk
+* background ILO calibration. \ref Cy_SysTick_TicklessIdle() advances it by
+* calling \ref Cy_SysClk_IloCalProcess() and uses the CPU Sleep while a
+* measurement is running. The ILO must be enabled and the System clock must be
+* sourced by the IMO.
+*
+* Tickless idle shares the WDT with the application. For the Deep Sleep it
+* enables the WDT, clears the ignore bits and sets the match to the wakeup
+* time. On wakeup it clears the WDT interrupt, which also services the
+* watchdog, and restores the ignore bits and the enable and interrupt mask
+* state. The application match is restored as the next match at or after the
+* current count. If the WDT counter passed the application match during the
+* Deep Sleep, the WDT interrupt is set again, so the application handler still
+* runs for it. The Deep Sleep is not entered while a WDT match of the
+* application is pending. The callbacks set by \ref Cy_SysTick_SetCallback()
+* are not called for the ticks spent in Deep Sleep.
+*
 * \section group_systick_more_information More Information
 *
 * Refer to the SysTick section of the ARM reference guide for complete details
@@ -98,6 +200,25 @@
 * <table class="doxtable">
 * <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 * <tr>
+* <td rowspan="4">1.10</td>
+* <td>Added the 64-bit monotonic clock: \ref Cy_SysTick_GetTicks(),
+*     \ref Cy_SysTick_GetCycles() and \ref Cy_SysTick_GetTimeUs().</td>
+* <td>A common time base for the application.</td>
+* </tr>
+* <tr>
+* <td>Added the software timers based on the hierarchical timer wheel.</td>
+* <td>The SysTick interrupt processes only the expired timers.</td>
+* </tr>
+* <tr>
+* <td>Added \ref Cy_SysTick_TicklessIdle().</td>
+* <td>Deep Sleep between the software timer deadlines.</td>
+* </tr>
+* <tr>
+* <td>Added \ref Cy_SysTick_DelayUs(), \ref Cy_SysTick_TimeoutStart(),
+*     \ref Cy_SysTick_TimeoutExpired() and \ref Cy_SysTick_IsTimeBaseRunning().</td>
+* <td>Delays that are not stretched by the interrupts and can sleep.</td>
+* </tr>
+* <tr>
 * <td>1.0</td>
 * <td>Initial version</td>
 * <td></td>
@@ -112,6 +233,7 @@
 #include <stdint.h>
 #include "cy_syslib.h"
 #include "cy_device.h"
+#include "cy_syspm.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -122,6 +244,43 @@ extern cy_israddress __RAM_VECTOR_TABLE[CY_VECTOR_TABLE_SIZE];
 typedef void (*Cy_SysTick_Callback)(void);
 /** \endcond */
 
+/**
+* \addtogroup group_systick_macros
+* \{
+*/
+
+#if !defined(CY_SYSTICK_TIMER_WHEEL)
+/** Enables the software timers. Set it to 1 to enable. */
+#define CY_SYSTICK_TIMER_WHEEL          (0U)
+#endif
+
+#if !defined(CY_SYSTICK_TIMER_WHEEL_BITS)
+/**
+* The number of the timer wheel slots per level is 2^CY_SYSTICK_TIMER_WHEEL_BITS.
+* The timer wheel occupies 4 * \ref CY_SYSTICK_TIMER_WHEEL_LEVELS *
+* 2^CY_SYSTICK_TIMER_WHEEL_BITS bytes of RAM.
+*/
+#define CY_SYSTICK_TIMER_WHEEL_BITS     (4UL)
+#endif
+
+/** The number of the timer wheel levels */
+#define CY_SYSTICK_TIMER_WHEEL_LEVELS   (4UL)
+
+#if !defined(CY_SYSTICK_CLK_LF_FREQ)
+/** The frequency of the clk_lf in Hz, used to convert the cycles to microseconds */
+#define CY_SYSTICK_CLK_LF_FREQ          (40000UL)
+#endif
+
+#if !defined(CY_SYSTICK_TICKLESS_MIN_TICKS)
+/** The minimum number of the idle ticks for \ref Cy_SysTick_TicklessIdle() to enter Deep Sleep */
+#define CY_SYSTICK_TICKLESS_MIN_TICKS   (2UL)
+#endif
+
+/** Returned by \ref Cy_SysTick_TimerGetIdleTicks() when no timer is running */
+#define CY_SYSTICK_IDLE_FOREVER         (0xFFFFFFFFUL)
+
+/** \} group_systick_macros */
+
 /**
 * \addtogroup group_systick_data_structures
 * \{
@@ -133,6 +292,28 @@ typedef enum
     CY_SYSTICK_CLOCK_SOURCE_CLK_CPU   = 1u,     /**< The System clock is selected. */
 } cy_en_systick_clock_source_t;
 
+/** The timeout started by \ref Cy_SysTick_TimeoutStart() */
+typedef struct
+{
+    uint64_t deadline;                      /**< The \ref Cy_SysTick_GetCycles() value the timeout expires at */
+} cy_stc_systick_timeout_t;
+
+#if (CY_SYSTICK_TIMER_WHEEL != 0U) || defined(CY_DOXYGEN)
+/** The software timer callback. The argument is the one passed to \ref Cy_SysTick_TimerInit(). */
+typedef void (*Cy_SysTick_TimerCallback)(void *arg);
+
+/** The software timer. The fields are for the driver internal use. */
+typedef struct cy_stc_systick_timer
+{
+    struct cy_stc_systick_timer *next;      /**< Next timer in the timer wheel slot */
+    struct cy_stc_systick_timer **pprev;    /**< Link to this timer in the timer wheel slot, NULL if the timer is stopped */
+    uint32_t expire;                        /**< The tick count the timer expires at */
+    uint32_t period;                        /**< The period in ticks, zero for the one-shot timer */
+    Cy_SysTick_TimerCallback callback;      /**< The timer callback */
+    void *arg;                              /**< The timer callback argument */
+} cy_stc_systick_timer_t;
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) || defined(CY_DOXYGEN) */
+
 /** \} group_systick_data_structures */
 
 
@@ -148,6 +329,21 @@ Cy_SysTick_Callback Cy_SysTick_SetCallback(uint32_t number, Cy_SysTick_Callback
 Cy_SysTick_Callback Cy_SysTick_GetCallback(uint32_t number);
 void Cy_SysTick_SetClockSource(cy_en_systick_clock_source_t clockSource);
 cy_en_systick_clock_source_t Cy_SysTick_GetClockSource(void);
+uint64_t Cy_SysTick_GetTicks(void);
+uint64_t Cy_SysTick_GetCycles(void);
+uint64_t Cy_SysTick_GetTimeUs(void);
+bool Cy_SysTick_IsTimeBaseRunning(void);
+void Cy_SysTick_TimeoutStart(cy_stc_systick_timeout_t *timeout, uint32_t microseconds);
+bool Cy_SysTick_TimeoutExpired(const cy_stc_systick_timeout_t *timeout);
+void Cy_SysTick_DelayUs(uint32_t microseconds, bool sleep);
+cy_en_syspm_status_t Cy_SysTick_TicklessIdle(uint32_t maxTicks);
+#if (CY_SYSTICK_TIMER_WHEEL != 0U) || defined(CY_DOXYGEN)
+void Cy_SysTick_TimerInit(cy_stc_systick_timer_t *timer, Cy_SysTick_TimerCallback callback, void *arg);
+void Cy_SysTick_TimerStart(cy_stc_systick_timer_t *timer, uint32_t delay, uint32_t period);
+void Cy_SysTick_TimerStop(cy_stc_systick_timer_t *timer);
+uint32_t Cy_SysTick_TimerGetIdleTicks(void);
+__STATIC_INLINE bool Cy_SysTick_TimerIsRunning(const cy_stc_systick_timer_t *timer);
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) || defined(CY_DOXYGEN) */
 __STATIC_INLINE void Cy_SysTick_EnableInterrupt(void);
 __STATIC_INLINE void Cy_SysTick_DisableInterrupt(void);
 __STATIC_INLINE void Cy_SysTick_SetReload(uint32_t value);
@@ -168,7 +364,7 @@ __STATIC_INLINE void Cy_SysTick_Clear(void);
 #define SYSTICK_DRV_VERSION_MAJOR       1
 
 /** Driver minor version */
-#define SYSTICK_DRV_VERSION_MINOR       0
+#define SYSTICK_DRV_VERSION_MINOR       10
 
 /** Number of the callbacks assigned to the SysTick interrupt */
 #define CY_SYS_SYST_NUM_OF_CALLBACKS         (5u)
@@ -294,6 +490,25 @@ __STATIC_INLINE uint32_t Cy_SysTick_GetCountFlag(void)
 }
 
 
+#if (CY_SYSTICK_TIMER_WHEEL != 0U) || defined(CY_DOXYGEN)
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerIsRunning
+****************************************************************************//**
+*
+* Checks whether the software timer is running.
+*
+* \param timer The pointer to the timer structure.
+*
+* \return True if the timer is running, false otherwise.
+*
+*******************************************************************************/
+__STATIC_INLINE bool Cy_SysTick_TimerIsRunning(const cy_stc_systick_timer_t *timer)
+{
+    return (NULL != timer->pprev);
+}
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) || defined(CY_DOXYGEN) */
+
+
 /** \} group_systick_functions */
 
 #ifdef __cplusplus
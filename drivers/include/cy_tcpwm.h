@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm.h
-* \version 1.0
+* \version 1.10
 *
 * The header file of the TCPWM driver.
 *
@@ -184,6 +184,41 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="5">1.10</td>
+*     <td>Added the \ref CY_TCPWM_DISPATCH macro.</td>
+*     <td>Convenience macro for the counter interrupt handlers bound to a
+*         TCPWM instance and counter at compile time.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the PWM sequencer: \ref Cy_TCPWM_PWM_SeqInit,
+*         \ref Cy_TCPWM_PWM_SeqStart, \ref Cy_TCPWM_PWM_SeqStop,
+*         \ref Cy_TCPWM_PWM_SeqSetTable and \ref Cy_TCPWM_PWM_SeqInterrupt.</td>
+*     <td>Streaming of the duty cycle tables into several PWM counters with
+*         the updates applied at the same terminal count.</td>
+*   </tr>
+*   <tr>
+*     <td>Added \ref Cy_TCPWM_PWM_GroupUpdate.</td>
+*     <td>Compare and period updates of several PWM counters applied at
+*         the same terminal count.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the QuadDec position and velocity estimator:
+*         \ref Cy_TCPWM_QuadDec_EstInit, \ref Cy_TCPWM_QuadDec_EstInterrupt,
+*         \ref Cy_TCPWM_QuadDec_EstGetPosition, \ref Cy_TCPWM_QuadDec_EstSample
+*         and \ref Cy_TCPWM_QuadDec_EstGetVelocity.</td>
+*     <td>64-bit position tracking and velocity estimation accurate at low
+*         speed.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the Counter capture service:
+*         \ref Cy_TCPWM_Counter_CaptureInit, \ref Cy_TCPWM_Counter_CaptureInterrupt,
+*         \ref Cy_TCPWM_Counter_CaptureGetNum, \ref Cy_TCPWM_Counter_CaptureRead,
+*         \ref Cy_TCPWM_Counter_CaptureMeasure and
+*         \ref Cy_TCPWM_Counter_CaptureGetDropped.</td>
+*     <td>32-bit input-capture timestamps buffered without critical sections,
+*         with frequency and duty cycle computation.</td>
+*   </tr>
+*   <tr>
 *     <td>1.0</td>
 *     <td>Initial version</td>
 *     <td></td>
@@ -240,7 +275,7 @@ extern "C" {
 #define CY_TCPWM_DRV_VERSION_MAJOR       1
 
 /** Driver minor version */
-#define CY_TCPWM_DRV_VERSION_MINOR       0
+#define CY_TCPWM_DRV_VERSION_MINOR       10
 
 
 /******************************************************************************
@@ -330,6 +365,46 @@ extern "C" {
 /** Initial value for the counter in the Up/Down counting modes */
 #define CY_TCPWM_CNT_UP_DOWN_INIT_VAL       (0x1U)
 
+/**
+* Defines an interrupt handler for one counter with the TCPWM instance,
+* counter number and callback context fixed at compile time. This is a
+* convenience that replaces the hand-written handler; the generated code is
+* the same.
+*
+* The generated handler reads the masked interrupt status, clears it and
+* calls callback(status, context), where status is a combination of
+* \ref group_tcpwm_interrupt_sources. Name the handler
+* \<interrupt_name\>_IRQHandler to place it in the flash vector table:
+* \code
+* static void PeriodElapsed(uint32_t status, void *context);
+*
+* CY_TCPWM_DISPATCH(tcpwm_interrupts_0_IRQHandler, TCPWM, 0UL, PeriodElapsed, NULL)
+* \endcode
+*
+* \param handler
+* The name of the generated handler.
+*
+* \param base
+* The pointer to a TCPWM instance.
+*
+* \param cntNum
+* The Counter instance number in the selected TCPWM.
+*
+* \param callback
+* The function of type void (uint32_t status, void *context) to call.
+*
+* \param context
+* The pointer passed to the callback.
+*/
+#define CY_TCPWM_DISPATCH(handler, base, cntNum, callback, context) \
+    void handler(void); \
+    void handler(void) \
+    { \
+        uint32_t intrStatus = Cy_TCPWM_GetInterruptStatusMasked((base), (cntNum)); \
+        Cy_TCPWM_ClearInterrupt((base), (cntNum), intrStatus); \
+        callback(intrStatus, (context)); \
+    }
+
 /** \} group_tcpwm_macros_common */
 
 
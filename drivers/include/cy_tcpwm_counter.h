@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm_counter.h
-* \version 1.0
+* \version 1.10
 *
 * \brief
 * The header file of the TCPWM Timer Counter driver.
@@ -41,6 +41,20 @@ extern "C" {
 * The functions and other declarations used in this part of the driver are 
 * in cy_tcpwm_counter.h. You can also include cy_pdl.h (ModusToolbox only) 
 * to get access to all functions and declarations in the PDL.
+*
+* The capture service (\ref Cy_TCPWM_Counter_CaptureInit) timestamps the
+* edges of a pulse signal, e.g. a flow meter output, with a counter in the
+* Capture mode that counts up with the period 0xFFFF.
+* \ref Cy_TCPWM_Counter_CaptureInterrupt, called from the counter interrupt
+* handler, extends each captured value to 32 bits with the number of counter
+* overflows and stores it in a single-producer single-consumer FIFO. The
+* application drains the FIFO in batches by \ref Cy_TCPWM_Counter_CaptureRead,
+* or computes the frequency and the duty cycle of the drained edges by
+* \ref Cy_TCPWM_Counter_CaptureMeasure, without disabling interrupts.
+*
+* To measure the duty cycle, capture on both edges and start the counter while
+* the input is low: the service treats the odd captures as the rising edges and
+* keeps the rising and falling edges of a pulse together when the FIFO is full.
 */
 
 /**
@@ -85,6 +99,41 @@ typedef struct cy_stc_tcpwm_counter_config
     /** Selects which input the count uses, the inputs are device-specific. See \ref group_tcpwm_input_selection */
     uint32_t    countInput;
 }cy_stc_tcpwm_counter_config_t;
+
+/**
+* Capture service state. All fields are for internal use. The structure is
+* allocated by the application and initialized by
+* \ref Cy_TCPWM_Counter_CaptureInit.
+*/
+typedef struct cy_stc_tcpwm_counter_capture
+{
+    /** \cond INTERNAL */
+    TCPWM_Type          *base;          /**< The TCPWM instance */
+    uint32_t            cntNum;         /**< The counter in the Capture mode */
+    uint32_t            *buffer;        /**< The timestamp FIFO buffer */
+    uint32_t            size;           /**< The FIFO buffer size, in timestamps */
+    uint32_t volatile   head;           /**< The FIFO write index, written by the interrupt only */
+    uint32_t volatile   tail;           /**< The FIFO read index, written by the reader only */
+    uint32_t volatile   dropped;        /**< The number of the captures lost on a full FIFO */
+    uint32_t            overflows;      /**< The number of the counter overflows, the upper timestamp half */
+    bool                bothEdges;      /**< The captures alternate between the rising and falling edges */
+    bool                risingNext;     /**< The next capture is a rising edge */
+    bool                skipFalling;    /**< The rising edge of the pulse was dropped, drop its falling edge */
+    bool                readRising;     /**< The next FIFO entry to read is a rising edge */
+    bool                lastRiseValid;  /**< lastRise holds the rising edge preceding the FIFO contents */
+    uint32_t            lastRise;       /**< The last rising edge consumed by the reader */
+    uint32_t            lastDropped;    /**< The dropped count seen by the reader */
+    /** \endcond */
+} cy_stc_tcpwm_counter_capture_t;
+
+/** The result of \ref Cy_TCPWM_Counter_CaptureMeasure */
+typedef struct cy_stc_tcpwm_counter_capture_result
+{
+    uint32_t    numPeriods;     /**< The number of the complete periods measured */
+    uint32_t    period;         /**< The average period, in the counter clocks */
+    uint32_t    frequency;      /**< The average frequency, in mHz */
+    uint32_t    duty;           /**< The average duty cycle, in 0.01 % units. Zero when the rising edges only are captured */
+} cy_stc_tcpwm_counter_capture_result_t;
 /** \} group_tcpwm_data_structures_counter */
 
 /**
@@ -144,6 +193,11 @@ typedef struct cy_stc_tcpwm_counter_config
 /** \} group_tcpwm_counter_status */
 /** \} group_tcpwm_macros_counter */
 
+/** \cond INTERNAL */
+#define CY_TCPWM_COUNTER_CAPTURE_HALF           (0x8000UL)  /**< Half of the 16-bit counter range */
+#define CY_TCPWM_COUNTER_CAPTURE_SHIFT          (16UL)      /**< The position of the overflow count in a timestamp */
+/** \endcond */
+
 
 /*******************************************************************************
 *        Function Prototypes
@@ -170,6 +224,14 @@ __STATIC_INLINE void Cy_TCPWM_Counter_SetCounter(TCPWM_Type *base, uint32_t cntN
 __STATIC_INLINE uint32_t Cy_TCPWM_Counter_GetCounter(TCPWM_Type const *base, uint32_t cntNum);
 __STATIC_INLINE void Cy_TCPWM_Counter_SetPeriod(TCPWM_Type *base, uint32_t cntNum, uint32_t period);
 __STATIC_INLINE uint32_t Cy_TCPWM_Counter_GetPeriod(TCPWM_Type const *base, uint32_t cntNum);
+cy_en_tcpwm_status_t Cy_TCPWM_Counter_CaptureInit(cy_stc_tcpwm_counter_capture_t *cap, TCPWM_Type *base,
+                                                  uint32_t cntNum, uint32_t *buffer, uint32_t size, bool bothEdges);
+void Cy_TCPWM_Counter_CaptureInterrupt(cy_stc_tcpwm_counter_capture_t *cap);
+uint32_t Cy_TCPWM_Counter_CaptureGetNum(cy_stc_tcpwm_counter_capture_t const *cap);
+uint32_t Cy_TCPWM_Counter_CaptureRead(cy_stc_tcpwm_counter_capture_t *cap, uint32_t *timestamps, uint32_t maxNum);
+uint32_t Cy_TCPWM_Counter_CaptureMeasure(cy_stc_tcpwm_counter_capture_t *cap, uint32_t clockFreq,
+                                         cy_stc_tcpwm_counter_capture_result_t *result);
+__STATIC_INLINE uint32_t Cy_TCPWM_Counter_CaptureGetDropped(cy_stc_tcpwm_counter_capture_t const *cap);
 
 
 /*******************************************************************************
@@ -528,6 +590,25 @@ __STATIC_INLINE uint32_t Cy_TCPWM_Counter_GetPeriod(TCPWM_Type const *base, uint
 {
     return(TCPWM_CNT_PERIOD(base, cntNum));
 }
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_CaptureGetDropped
+****************************************************************************//**
+*
+* Returns the number of the captures lost because the timestamp FIFO was full.
+*
+* \param cap
+* The pointer to the capture service structure.
+*
+* \return
+* The number of the dropped captures since \ref Cy_TCPWM_Counter_CaptureInit.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t Cy_TCPWM_Counter_CaptureGetDropped(cy_stc_tcpwm_counter_capture_t const *cap)
+{
+    return(cap->dropped);
+}
 /** \} group_tcpwm_functions_counter */
 
 /** \} group_tcpwm_counter */
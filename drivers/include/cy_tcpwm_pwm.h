@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm_pwm.h
-* \version 1.0
+* \version 1.10
 *
 * \brief
 * The header file of the TCPWM PWM driver.
@@ -41,6 +41,35 @@ extern "C" {
 * The functions and other declarations used in this part of the driver are in cy_tcpwm_pwm.h. 
 * You can also include cy_pdl.h (ModusToolbox only) to get access to all  
 * functions and declarations in the PDL.
+*
+* The PWM sequencer (\ref Cy_TCPWM_PWM_SeqInit) streams a const table of
+* compare values, and optionally periods, into the buffered CC_BUFF and
+* PERIOD_BUFF registers of one or more PWM counters. Each terminal count
+* interrupt of the first counter writes the values for the period after the
+* next one and arms the swap of all counters with a single
+* \ref Cy_TCPWM_TriggerCaptureOrSwap command, so the hardware applies them at
+* the same terminal count on every counter. A new table can be queued with
+* \ref Cy_TCPWM_PWM_SeqSetTable; it replaces the current one when the current
+* one wraps around. The compare table holds one value per counter for each
+* step, in ascending counter number order.
+*
+* To change the values of several counters at once outside of a sequence,
+* use \ref Cy_TCPWM_PWM_GroupUpdate. It writes the buffered registers of all
+* the counters first and then arms their swap with one command, so that no
+* counter applies its new value a period later than the others.
+*
+* \code
+* static const uint16_t sineTable[64U * 3U] = { ... };
+* static cy_stc_tcpwm_pwm_seq_t seq;
+*
+* (void) Cy_TCPWM_PWM_SeqInit(&seq, TCPWM, 0x07UL, sineTable, NULL, 64UL);
+* Cy_TCPWM_PWM_SeqStart(&seq);
+*
+* void tcpwm_interrupts_0_IRQHandler(void)
+* {
+*     Cy_TCPWM_PWM_SeqInterrupt(&seq);
+* }
+* \endcode
 * \{
 */
 
@@ -50,11 +79,55 @@ extern "C" {
 * \defgroup group_tcpwm_data_structures_pwm Data Structures
 * \} */
 
+/**
+* \addtogroup group_tcpwm_macros_pwm
+* \{
+*/
+#if !defined(CY_TCPWM_PWM_SEQ_MAX_CHANNELS)
+    /** The maximum number of the counters driven by one PWM sequencer */
+    #define CY_TCPWM_PWM_SEQ_MAX_CHANNELS   (4UL)
+#endif /* !defined(CY_TCPWM_PWM_SEQ_MAX_CHANNELS) */
+/** \} group_tcpwm_macros_pwm */
+
 /**
 * \addtogroup group_tcpwm_data_structures_pwm
 * \{
 */
 
+/** One counter update of \ref Cy_TCPWM_PWM_GroupUpdate */
+typedef struct
+{
+    uint32_t    cntNum;             /**< The Counter instance number in the TCPWM */
+    uint32_t    compare;            /**< The new compare value */
+    uint32_t    period;             /**< The new period value, used when the periods are updated */
+} cy_stc_tcpwm_pwm_group_update_t;
+
+/**
+* PWM sequencer state. All fields are for internal use. The structure is
+* allocated by the application and initialized by \ref Cy_TCPWM_PWM_SeqInit.
+*/
+typedef struct cy_stc_tcpwm_pwm_seq
+{
+    /** \cond INTERNAL */
+    TCPWM_Type          *base;          /**< The TCPWM instance */
+    uint32_t            counters;       /**< The bit mask of the sequenced counters */
+    uint32_t            masterNum;      /**< The counter whose terminal count interrupt drives the sequence */
+    uint32_t            numChannels;    /**< The number of the sequenced counters */
+    TCPWM_CNT_Type      *cnt[CY_TCPWM_PWM_SEQ_MAX_CHANNELS]; /**< The counter registers, in table order */
+    uint16_t const      *compare;       /**< The compare values, numChannels per step */
+    uint16_t const      *period;        /**< The period per step, or NULL */
+    uint32_t            numSteps;       /**< The number of the steps in the table */
+    uint32_t            step;           /**< The step to write on the next interrupt */
+    /* The queued table is volatile, so its stores are not moved after the
+    * nextPending store that publishes it to the interrupt.
+    */
+    uint16_t const * volatile nextCompare;  /**< The queued compare table */
+    uint16_t const * volatile nextPeriod;   /**< The queued period table */
+    uint32_t volatile   nextNumSteps;   /**< The number of the steps in the queued table */
+    bool volatile       nextPending;    /**< The queued table replaces the current one at the wrap */
+    /** \endcond */
+} cy_stc_tcpwm_pwm_seq_t;
+
 /** PWM configuration structure */
 typedef struct cy_stc_tcpwm_pwm_config
 {
@@ -213,6 +286,15 @@ typedef struct cy_stc_tcpwm_pwm_config
 
 cy_en_tcpwm_status_t Cy_TCPWM_PWM_Init(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_pwm_config_t const *config);
 void Cy_TCPWM_PWM_DeInit(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_pwm_config_t const *config);
+cy_en_tcpwm_status_t Cy_TCPWM_PWM_SeqInit(cy_stc_tcpwm_pwm_seq_t *seq, TCPWM_Type *base, uint32_t counters,
+                                          uint16_t const *compare, uint16_t const *period, uint32_t numSteps);
+void Cy_TCPWM_PWM_SeqStart(cy_stc_tcpwm_pwm_seq_t *seq);
+void Cy_TCPWM_PWM_SeqStop(cy_stc_tcpwm_pwm_seq_t *seq);
+bool Cy_TCPWM_PWM_SeqSetTable(cy_stc_tcpwm_pwm_seq_t *seq, uint16_t const *compare,
+                              uint16_t const *period, uint32_t numSteps);
+void Cy_TCPWM_PWM_SeqInterrupt(cy_stc_tcpwm_pwm_seq_t *seq);
+void Cy_TCPWM_PWM_GroupUpdate(TCPWM_Type *base, cy_stc_tcpwm_pwm_group_update_t const *updates,
+                              uint32_t numUpdates, bool updatePeriod);
 __STATIC_INLINE void Cy_TCPWM_PWM_Enable(TCPWM_Type *base, uint32_t cntNum);
 __STATIC_INLINE void Cy_TCPWM_PWM_Disable(TCPWM_Type *base, uint32_t cntNum);
 __STATIC_INLINE uint32_t Cy_TCPWM_PWM_GetStatus(TCPWM_Type const *base, uint32_t cntNum);
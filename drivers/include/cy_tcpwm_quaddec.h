@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm_quaddec.h
-* \version 1.0
+* \version 1.10
 *
 * \brief
 * The header file of the TCPWM Quadrature Decoder driver.
@@ -39,6 +39,23 @@ extern "C" {
 *
 * The functions and other declarations used in this part of the driver are in cy_tcpwm_quaddec.h. 
 * You can also include cy_pdl.h (ModusToolbox only) to get access to all functions and declarations in the PDL.
+*
+* The position and velocity estimator (\ref Cy_TCPWM_QuadDec_EstInit) extends
+* the 16-bit QuadDec counter to a 64-bit position. The QuadDec reloads the
+* counter with 0x8000 and captures the previous value on every overflow,
+* underflow and index event; \ref Cy_TCPWM_QuadDec_EstInterrupt adds the
+* captured offset to the accumulated position in constant time.
+* \ref Cy_TCPWM_QuadDec_EstGetPosition combines it with the live counter
+* without disabling interrupts and accounts for an event whose interrupt is
+* still pending.
+*
+* \ref Cy_TCPWM_QuadDec_EstSample, called at a fixed rate, updates the velocity.
+* At high speed, it divides the position change by the sample period. When
+* fewer than minCounts counts occur per sample, and a second counter in the
+* Capture mode timestamps the phiA edges, the velocity is computed from the
+* time between the last two captured edges instead, which keeps the
+* resolution at low speed. \ref Cy_TCPWM_QuadDec_EstGetVelocity reads the
+* result.
 * \{
 */
 
@@ -74,6 +91,40 @@ typedef struct cy_stc_tcpwm_quaddec_config
     uint32_t    phiBInput;
     
 }cy_stc_tcpwm_quaddec_config_t;
+
+/** Position and velocity estimator configuration structure */
+typedef struct cy_stc_tcpwm_quaddec_est_config
+{
+    /**
+    * The counter in the Capture mode whose capture input is the phiA signal,
+    * or \ref CY_TCPWM_QUADDEC_EST_NO_TIMER to compute the velocity from the
+    * position change only. It must count up with the period 0xFFFF.
+    */
+    uint32_t    timerNum;
+    uint32_t    timerFreq;          /**< The clock frequency of the capture counter, in Hz */
+    uint32_t    countsPerCapture;   /**< The QuadDec counts between two captures, e.g. 4 for the X4 mode and the rising phiA edge */
+    uint32_t    sampleFreq;         /**< The rate of the \ref Cy_TCPWM_QuadDec_EstSample calls, in Hz */
+    uint32_t    minCounts;          /**< Below this number of the counts per sample, the edge period is used */
+} cy_stc_tcpwm_quaddec_est_config_t;
+
+/**
+* Position and velocity estimator state. All fields are for internal use. The
+* structure is allocated by the application and initialized by
+* \ref Cy_TCPWM_QuadDec_EstInit.
+*/
+typedef struct cy_stc_tcpwm_quaddec_est
+{
+    /** \cond INTERNAL */
+    TCPWM_Type          *base;          /**< The TCPWM instance */
+    uint32_t            cntNum;         /**< The QuadDec counter */
+    cy_stc_tcpwm_quaddec_est_config_t config; /**< The estimator configuration */
+    int64_t volatile    accum;          /**< The position at the last counter reload */
+    uint32_t volatile   updateCount;    /**< Incremented on each accum update */
+    int64_t             lastPos;        /**< The position at the previous sample */
+    uint32_t            idleTicks;      /**< The capture counter ticks since the last edge, saturated */
+    int32_t volatile    velocity;       /**< The velocity in counts per second */
+    /** \endcond */
+} cy_stc_tcpwm_quaddec_est_t;
 /** \} group_tcpwm_data_structures_quaddec */
 
 /**
@@ -98,12 +149,16 @@ typedef struct cy_stc_tcpwm_quaddec_config
 #define CY_TCPWM_QUADDEC_STATUS_COUNTER_RUNNING     (TCPWM_CNT_STATUS_RUNNING_Msk)
 /** \} group_tcpwm_quaddec_status */
 
+/** The estimator has no capture counter, see \ref cy_stc_tcpwm_quaddec_est_config_t */
+#define CY_TCPWM_QUADDEC_EST_NO_TIMER               (0xFFFFFFFFUL)
+
 
 /***************************************
 *        Registers Constants
 ***************************************/
 /** \cond INTERNAL */
 #define CY_TCPWM_QUADDEC_CTRL_QUADDEC_MODE          (0x3UL)     /**< Quadrature encoding mode for CTRL register */
+#define CY_TCPWM_QUADDEC_RELOAD_VAL                 (0x8000UL)  /**< The counter value after a reload event */
 /** \endcond */
 /** \} group_tcpwm_macros_quaddec */
 
@@ -120,6 +175,12 @@ typedef struct cy_stc_tcpwm_quaddec_config
 cy_en_tcpwm_status_t Cy_TCPWM_QuadDec_Init(TCPWM_Type *base, uint32_t cntNum, 
                                            cy_stc_tcpwm_quaddec_config_t const *config);
 void Cy_TCPWM_QuadDec_DeInit(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_quaddec_config_t const *config);
+cy_en_tcpwm_status_t Cy_TCPWM_QuadDec_EstInit(cy_stc_tcpwm_quaddec_est_t *est, TCPWM_Type *base, uint32_t cntNum,
+                                              cy_stc_tcpwm_quaddec_est_config_t const *config);
+void Cy_TCPWM_QuadDec_EstInterrupt(cy_stc_tcpwm_quaddec_est_t *est);
+int64_t Cy_TCPWM_QuadDec_EstGetPosition(cy_stc_tcpwm_quaddec_est_t const *est);
+void Cy_TCPWM_QuadDec_EstSample(cy_stc_tcpwm_quaddec_est_t *est);
+__STATIC_INLINE int32_t Cy_TCPWM_QuadDec_EstGetVelocity(cy_stc_tcpwm_quaddec_est_t const *est);
 __STATIC_INLINE void Cy_TCPWM_QuadDec_Enable(TCPWM_Type *base, uint32_t cntNum);
 __STATIC_INLINE void Cy_TCPWM_QuadDec_Disable(TCPWM_Type *base, uint32_t cntNum);
 __STATIC_INLINE uint32_t Cy_TCPWM_QuadDec_GetStatus(TCPWM_Type const *base, uint32_t cntNum);
@@ -303,6 +364,26 @@ __STATIC_INLINE uint32_t Cy_TCPWM_QuadDec_GetCounter(TCPWM_Type const *base, uin
     return(TCPWM_CNT_COUNTER(base, cntNum));
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_QuadDec_EstGetVelocity
+****************************************************************************//**
+*
+* Returns the velocity computed by the last \ref Cy_TCPWM_QuadDec_EstSample call.
+*
+* \param est
+* The pointer to the estimator structure.
+*
+* \return
+* The velocity in QuadDec counts per second. It is negative when the counter
+* counts down.
+*
+*******************************************************************************/
+__STATIC_INLINE int32_t Cy_TCPWM_QuadDec_EstGetVelocity(cy_stc_tcpwm_quaddec_est_t const *est)
+{
+    return(est->velocity);
+}
+
 /** \} group_tcpwm_functions_quaddec */
 
 /** \} group_tcpwm_quaddec */
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_gpio.c
-* \version 1.0
+* \version 1.10
 *
 * Provides an API implementation of the GPIO driver
 *
@@ -93,7 +93,8 @@ cy_en_gpio_status_t Cy_GPIO_Pin_Init(GPIO_PRT_Type *base, uint32_t pinNum, const
         Cy_GPIO_SetHSIOM(base, pinNum, config->hsiom);
 
         Cy_GPIO_SetInterruptEdge(base, pinNum, config->intEdge);
-        Cy_GPIO_SetVtrip(base, config->slewRate);
+        Cy_GPIO_SetVtrip(base, config->vtrip);
+        Cy_GPIO_SetSlewRate(base, config->slewRate);
 
         /* SIO specific configuration */
         tempReg = GPIO_PRT_SIO(base) & ~(CY_GPIO_SIO_PIN_MASK);
@@ -170,6 +171,232 @@ cy_en_gpio_status_t Cy_GPIO_Port_Init(GPIO_PRT_Type* base, const cy_stc_gpio_prt
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_GPIO_Board_Init
+****************************************************************************//**
+*
+* Initializes the pins from a const board configuration table.
+*
+* The settings of the consecutive table entries that belong to the same port
+* are merged into whole-register images, which are then applied to the port
+* with a single read-modify-write operation per port register. The pins of the
+* port that are not listed in the table keep their configuration. Each pin is
+* configured the same way as \ref Cy_GPIO_Pin_Init does.
+*
+* \param pins
+* Pointer to the board configuration table. Group the entries of each port
+* together to get a single write per port register.
+*
+* \param numPins
+* Number of entries in the table
+*
+* \return
+* Initialization status. \ref CY_GPIO_BAD_PARAM is returned and no pin is
+* configured if the table is NULL, or an entry has no configuration or an
+* invalid port or pin number.
+*
+* \note
+* The vtrip and slewRate settings are common for all the pins of the port.
+* The values of the last table entry of the port are applied.
+*
+* \note
+* This function modifies port registers in read-modify-write operations. It is
+* not thread safe as the resource is shared among multiple pins on a port.
+*
+*******************************************************************************/
+cy_en_gpio_status_t Cy_GPIO_Board_Init(const cy_stc_gpio_board_pin_t *pins, uint32_t numPins)
+{
+    cy_en_gpio_status_t status = CY_GPIO_BAD_PARAM;
+    uint32_t idx;
+
+    if (NULL != pins)
+    {
+        status = CY_GPIO_SUCCESS;
+
+        for (idx = 0UL; idx < numPins; idx++)
+        {
+            /* The port and pin numbers select the registers, so check them in every build */
+            if ((NULL == pins[idx].config) ||
+                (pins[idx].portNum >= (uint32_t)IOSS_GPIO_GPIO_PORT_NR) ||
+                (!CY_GPIO_IS_PIN_VALID(pins[idx].pinNum)))
+            {
+                status = CY_GPIO_BAD_PARAM;
+            }
+        }
+    }
+
+    if (CY_GPIO_SUCCESS == status)
+    {
+        idx = 0UL;
+
+        while (idx < numPins)
+        {
+            uint32_t portNum = pins[idx].portNum;
+            cy_stc_gpio_prt_config_t value = {0UL, 0UL, 0UL, 0UL, 0UL, 0UL};
+            cy_stc_gpio_prt_config_t mask  = {0UL, 0UL, 0UL, 0UL, 0UL, 0UL};
+            GPIO_PRT_Type* base;
+            HSIOM_PRT_Type* baseHSIOM;
+
+            CY_ASSERT_L2(portNum < (uint32_t)IOSS_GPIO_GPIO_PORT_NR);
+
+            /* Merge the consecutive entries of the port into the register images */
+            do
+            {
+                uint32_t pinNum = pins[idx].pinNum;
+                const cy_stc_gpio_pin_config_t *config = pins[idx].config;
+
+                CY_ASSERT_L2(CY_GPIO_IS_PIN_VALID(pinNum));
+                CY_ASSERT_L2(CY_GPIO_IS_VALUE_VALID(config->outVal));
+                CY_ASSERT_L2(CY_GPIO_IS_DM_VALID(config->driveMode));
+                CY_ASSERT_L2(CY_GPIO_IS_HSIOM_VALID(config->hsiom));
+                CY_ASSERT_L2(CY_GPIO_IS_INT_EDGE_VALID(config->intEdge));
+                CY_ASSERT_L2(CY_GPIO_IS_VALUE_VALID(config->vtrip));
+                CY_ASSERT_L2(CY_GPIO_IS_VALUE_VALID(config->slewRate));
+                CY_ASSERT_L2(CY_GPIO_IS_VALUE_VALID(config->vregEn));
+                CY_ASSERT_L2(CY_GPIO_IS_VALUE_VALID(config->ibufMode));
+                CY_ASSERT_L2(CY_GPIO_IS_VALUE_VALID(config->vtripSel));
+                CY_ASSERT_L2(CY_GPIO_IS_VREF_SEL_VALID(config->vrefSel));
+                CY_ASSERT_L2(CY_GPIO_IS_VOH_SEL_VALID(config->vohSel));
+
+                value.dr &= ~CY_GPIO_PRT_DR(pinNum, CY_GPIO_DR_MASK);
+                value.dr |= CY_GPIO_PRT_DR(pinNum, config->outVal);
+                mask.dr  |= CY_GPIO_PRT_DR(pinNum, CY_GPIO_DR_MASK);
+
+                value.pc &= ~(CY_GPIO_PRT_PC(pinNum, CY_GPIO_PC_DM_MASK) |
+                              GPIO_PRT_PC_PORT_VTRIP_SEL_Msk | GPIO_PRT_PC_PORT_SLOW_Msk);
+                value.pc |= CY_GPIO_PRT_PC(pinNum, config->driveMode) |
+                            CY_GPIO_PRT_PC_PORT(config->vtrip, config->slewRate);
+                mask.pc  |= CY_GPIO_PRT_PC(pinNum, CY_GPIO_PC_DM_MASK) |
+                            GPIO_PRT_PC_PORT_VTRIP_SEL_Msk | GPIO_PRT_PC_PORT_SLOW_Msk;
+
+                value.pc2 &= ~CY_GPIO_PRT_PC2(pinNum, CY_GPIO_DM_VAL_IBUF_DISABLE_MASK);
+                value.pc2 |= CY_GPIO_PRT_PC2(pinNum, config->driveMode);
+                mask.pc2  |= CY_GPIO_PRT_PC2(pinNum, CY_GPIO_DM_VAL_IBUF_DISABLE_MASK);
+
+                value.intrCfg &= ~CY_GPIO_PRT_INTR_CFG(pinNum, CY_GPIO_INTR_EDGE_MASK);
+                value.intrCfg |= CY_GPIO_PRT_INTR_CFG(pinNum, config->intEdge);
+                mask.intrCfg  |= CY_GPIO_PRT_INTR_CFG(pinNum, CY_GPIO_INTR_EDGE_MASK);
+
+                value.selActive &= ~CY_GPIO_PRT_SEL(pinNum, CY_GPIO_HSIOM_MASK);
+                value.selActive |= CY_GPIO_PRT_SEL(pinNum, config->hsiom);
+                mask.selActive  |= CY_GPIO_PRT_SEL(pinNum, CY_GPIO_HSIOM_MASK);
+
+                /* SIO specific configuration */
+                value.sio &= ~(CY_GPIO_SIO_CFG_MASK << ((pinNum & CY_GPIO_SIO_ODD_PIN_MASK) << CY_GPIO_CFG_SIO_OFFSET));
+                value.sio |= CY_GPIO_PRT_SIO(pinNum, config->vregEn, config->ibufMode,
+                                             config->vtripSel, config->vrefSel, config->vohSel);
+                mask.sio  |= CY_GPIO_SIO_CFG_MASK << ((pinNum & CY_GPIO_SIO_ODD_PIN_MASK) << CY_GPIO_CFG_SIO_OFFSET);
+
+                idx++;
+            }
+            while ((idx < numPins) && (portNum == pins[idx].portNum));
+
+            base = Cy_GPIO_PortToAddr(portNum);
+            baseHSIOM = (HSIOM_PRT_Type*)(HSIOM_BASE + (HSIOM_PRT_SECTION_SIZE * portNum));
+
+            GPIO_PRT_DR(base)       = (GPIO_PRT_DR(base) & ~mask.dr) | value.dr;
+            GPIO_PRT_PC(base)       = (GPIO_PRT_PC(base) & ~mask.pc) | value.pc;
+            GPIO_PRT_PC2(base)      = (GPIO_PRT_PC2(base) & ~mask.pc2) | value.pc2;
+            GPIO_PRT_INTR_CFG(base) = (GPIO_PRT_INTR_CFG(base) & ~mask.intrCfg) | value.intrCfg;
+            GPIO_PRT_SIO(base)      = (GPIO_PRT_SIO(base) & ~mask.sio) | value.sio;
+            HSIOM_PRT_PORT_SEL(baseHSIOM) = (HSIOM_PRT_PORT_SEL(baseHSIOM) & ~mask.selActive) | value.selActive;
+        }
+    }
+
+    return (status);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_GPIO_PinGroup_Write
+****************************************************************************//**
+*
+* Writes a logical value to the pins of the pin group.
+*
+* The bits of the adjacent segments of the same port are merged, so each port
+* is updated with one write to the port output data set register followed by
+* one write to the port output data clear register. The other pins of the
+* ports are not affected.
+*
+* This function should be used only for software driven pins. It does not have
+* any effect on peripheral driven pins.
+*
+* \param group
+* Pointer to the pin group descriptor
+*
+* \param value
+* Logical value to drive out on the pins of the group
+*
+*******************************************************************************/
+void Cy_GPIO_PinGroup_Write(const cy_stc_gpio_pin_group_t *group, uint32_t value)
+{
+    uint32_t idx = 0UL;
+
+    CY_ASSERT_L1(NULL != group);
+
+    while (idx < group->numSeg)
+    {
+        GPIO_PRT_Type* base = group->seg[idx].base;
+        uint32_t pinMask = 0UL;
+        uint32_t pinVal = 0UL;
+
+        do
+        {
+            const cy_stc_gpio_pin_group_seg_t *seg = &group->seg[idx];
+
+            pinMask |= seg->mask << seg->pinPos;
+            pinVal  |= ((value >> seg->bitPos) & seg->mask) << seg->pinPos;
+            idx++;
+        }
+        while ((idx < group->numSeg) && (base == group->seg[idx].base));
+
+        Cy_GPIO_Port_Write(base, pinMask, pinVal);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_GPIO_PinGroup_Read
+****************************************************************************//**
+*
+* Reads a logical value from the input buffers of the pins of the pin group.
+*
+* The input register of each port is read once for all the adjacent segments
+* of the port.
+*
+* \param group
+* Pointer to the pin group descriptor
+*
+* \return
+* Logical value present on the pins of the group
+*
+*******************************************************************************/
+uint32_t Cy_GPIO_PinGroup_Read(const cy_stc_gpio_pin_group_t *group)
+{
+    uint32_t retVal = 0UL;
+    uint32_t idx = 0UL;
+
+    CY_ASSERT_L1(NULL != group);
+
+    while (idx < group->numSeg)
+    {
+        GPIO_PRT_Type* base = group->seg[idx].base;
+        uint32_t pinVal = GPIO_PRT_IN(base);
+
+        do
+        {
+            const cy_stc_gpio_pin_group_seg_t *seg = &group->seg[idx];
+
+            retVal |= ((pinVal >> seg->pinPos) & seg->mask) << seg->bitPos;
+            idx++;
+        }
+        while ((idx < group->numSeg) && (base == group->seg[idx].base));
+    }
+
+    return (retVal);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_GPIO_SetAmuxSplit
 ****************************************************************************//**
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_common.c
-* \version 1.0
+* \version 1.10
 *
 * Provides common API implementation of the SCB driver.
 *
@@ -52,27 +52,13 @@ extern "C" {
 *******************************************************************************/
 void Cy_SCB_ReadArrayNoCheck(CySCB_Type const *base, void *buffer, uint32_t size)
 {
-    uint32_t idx;
-
     if (Cy_SCB_IsRxDataWidthByte(base))
     {
-        uint8_t *buf = (uint8_t *) buffer;
-
-        /* Get data available in RX FIFO */
-        for (idx = 0UL; idx < size; ++idx)
-        {
-            buf[idx] = (uint8_t) Cy_SCB_ReadRxFifo(base);
-        }
+        Cy_SCB_ReadArrayNoCheck8(base, (uint8_t *) buffer, size);
     }
     else
     {
-        uint16_t *buf = (uint16_t *) buffer;
-
-        /* Get data available in RX FIFO */
-        for (idx = 0UL; idx < size; ++idx)
-        {
-            buf[idx] = (uint16_t) Cy_SCB_ReadRxFifo(base);
-        }
+        Cy_SCB_ReadArrayNoCheck16(base, (uint16_t *) buffer, size);
     }
 }
 
@@ -217,27 +203,13 @@ uint32_t Cy_SCB_Write(CySCB_Type *base, uint32_t data)
 *******************************************************************************/
 void Cy_SCB_WriteArrayNoCheck(CySCB_Type *base, void const *buffer, uint32_t size)
 {
-    uint32_t idx;
-
     if (Cy_SCB_IsTxDataWidthByte(base))
     {
-        uint8_t const *buf = (uint8_t *) buffer;
-
-        /* Put data into TX FIFO */
-        for (idx = 0UL; idx < size; ++idx)
-        {
-            Cy_SCB_WriteTxFifo(base, (uint32_t) buf[idx]);
-        }
+        Cy_SCB_WriteArrayNoCheck8(base, (uint8_t const *) buffer, size);
     }
     else
     {
-        uint16_t const *buf = (uint16_t *) buffer;
-
-        /* Put data into TX FIFO */
-        for (idx = 0UL; idx < size; ++idx)
-        {
-            Cy_SCB_WriteTxFifo(base, (uint32_t) buf[idx]);
-        }
+        Cy_SCB_WriteArrayNoCheck16(base, (uint16_t const *) buffer, size);
     }
 }
 
@@ -420,6 +392,262 @@ uint32_t Cy_SCB_WriteDefaultArray(CySCB_Type *base, uint32_t txData, uint32_t si
     return (numToCopy);
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_SCB_ReadArrayNoCheck8
+****************************************************************************//**
+*
+* Reads an array of 8-bit data elements out of the SCB receive FIFO without
+* checking if the receive FIFO has enough data elements. The data width is
+* not read from the hardware.
+* Before calling this function, make sure that the receive FIFO has enough data
+* elements to be read.
+*
+* \param base
+* The pointer to the SCB instance.
+*
+* \param buffer
+* The pointer to location to place data read from the receive FIFO.
+*
+* \param size
+* The number of data elements read from the receive FIFO.
+*
+*******************************************************************************/
+void Cy_SCB_ReadArrayNoCheck8(CySCB_Type const *base, uint8_t buffer[], uint32_t size)
+{
+    uint32_t idx = 0UL;
+    uint32_t burstSize = (size & (uint32_t) ~(CY_SCB_FIFO_BURST_SIZE - 1UL));
+
+    /* Get data available in RX FIFO in bursts */
+    while (idx < burstSize)
+    {
+        buffer[idx]       = (uint8_t) Cy_SCB_ReadRxFifo(base);
+        buffer[idx + 1UL] = (uint8_t) Cy_SCB_ReadRxFifo(base);
+        buffer[idx + 2UL] = (uint8_t) Cy_SCB_ReadRxFifo(base);
+        buffer[idx + 3UL] = (uint8_t) Cy_SCB_ReadRxFifo(base);
+
+        idx += CY_SCB_FIFO_BURST_SIZE;
+    }
+
+    /* Get the remaining data */
+    while (idx < size)
+    {
+        buffer[idx] = (uint8_t) Cy_SCB_ReadRxFifo(base);
+        ++idx;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_ReadArrayNoCheck16
+****************************************************************************//**
+*
+* Reads an array of 16-bit data elements out of the SCB receive FIFO without
+* checking if the receive FIFO has enough data elements. The data width is
+* not read from the hardware.
+* Before calling this function, make sure that the receive FIFO has enough data
+* elements to be read.
+*
+* \param base
+* The pointer to the SCB instance.
+*
+* \param buffer
+* The pointer to location to place data read from the receive FIFO.
+*
+* \param size
+* The number of data elements read from the receive FIFO.
+*
+*******************************************************************************/
+void Cy_SCB_ReadArrayNoCheck16(CySCB_Type const *base, uint16_t buffer[], uint32_t size)
+{
+    uint32_t idx = 0UL;
+    uint32_t burstSize = (size & (uint32_t) ~(CY_SCB_FIFO_BURST_SIZE - 1UL));
+
+    /* Get data available in RX FIFO in bursts */
+    while (idx < burstSize)
+    {
+        buffer[idx]       = (uint16_t) Cy_SCB_ReadRxFifo(base);
+        buffer[idx + 1UL] = (uint16_t) Cy_SCB_ReadRxFifo(base);
+        buffer[idx + 2UL] = (uint16_t) Cy_SCB_ReadRxFifo(base);
+        buffer[idx + 3UL] = (uint16_t) Cy_SCB_ReadRxFifo(base);
+
+        idx += CY_SCB_FIFO_BURST_SIZE;
+    }
+
+    /* Get the remaining data */
+    while (idx < size)
+    {
+        buffer[idx] = (uint16_t) Cy_SCB_ReadRxFifo(base);
+        ++idx;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_ReadArray8
+****************************************************************************//**
+*
+* Reads an array of 8-bit data elements out of the SCB receive FIFO.
+* This function does not block; it returns how many data elements are
+* read from the receive FIFO. The data width is not read from the hardware.
+*
+* \param base
+* The pointer to the SCB instance.
+*
+* \param buffer
+* The pointer to location to place data read from receive FIFO.
+*
+* \param size
+* The number of data elements to read from the receive FIFO.
+*
+* \return
+* The number of data elements read from the receive FIFO.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_ReadArray8(CySCB_Type const *base, uint8_t buffer[], uint32_t size)
+{
+    /* Get available items in RX FIFO */
+    uint32_t numToCopy = Cy_SCB_GetNumInRxFifo(base);
+
+    /* Adjust items that will be read */
+    if (numToCopy > size)
+    {
+        numToCopy = size;
+    }
+
+    Cy_SCB_ReadArrayNoCheck8(base, buffer, numToCopy);
+
+    return (numToCopy);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_WriteArrayNoCheck8
+****************************************************************************//**
+*
+* Places an array of 8-bit data elements in the SCB transmit FIFO without
+* checking whether the transmit FIFO has enough space. The data width is
+* not read from the hardware.
+* Before calling this function, make sure that the transmit FIFO has enough
+* space to put all requested data elements.
+*
+* \param base
+* The pointer to the SCB instance.
+*
+* \param buffer
+* The pointer to data to place in the transmit FIFO.
+*
+* \param size
+* The number of data elements to transmit.
+*
+*******************************************************************************/
+void Cy_SCB_WriteArrayNoCheck8(CySCB_Type *base, uint8_t const buffer[], uint32_t size)
+{
+    uint32_t idx = 0UL;
+    uint32_t burstSize = (size & (uint32_t) ~(CY_SCB_FIFO_BURST_SIZE - 1UL));
+
+    /* Put data into TX FIFO in bursts */
+    while (idx < burstSize)
+    {
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx]);
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx + 1UL]);
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx + 2UL]);
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx + 3UL]);
+
+        idx += CY_SCB_FIFO_BURST_SIZE;
+    }
+
+    /* Put the remaining data */
+    while (idx < size)
+    {
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx]);
+        ++idx;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_WriteArrayNoCheck16
+****************************************************************************//**
+*
+* Places an array of 16-bit data elements in the SCB transmit FIFO without
+* checking whether the transmit FIFO has enough space. The data width is
+* not read from the hardware.
+* Before calling this function, make sure that the transmit FIFO has enough
+* space to put all requested data elements.
+*
+* \param base
+* The pointer to the SCB instance.
+*
+* \param buffer
+* The pointer to data to place in the transmit FIFO.
+*
+* \param size
+* The number of data elements to transmit.
+*
+*******************************************************************************/
+void Cy_SCB_WriteArrayNoCheck16(CySCB_Type *base, uint16_t const buffer[], uint32_t size)
+{
+    uint32_t idx = 0UL;
+    uint32_t burstSize = (size & (uint32_t) ~(CY_SCB_FIFO_BURST_SIZE - 1UL));
+
+    /* Put data into TX FIFO in bursts */
+    while (idx < burstSize)
+    {
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx]);
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx + 1UL]);
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx + 2UL]);
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx + 3UL]);
+
+        idx += CY_SCB_FIFO_BURST_SIZE;
+    }
+
+    /* Put the remaining data */
+    while (idx < size)
+    {
+        Cy_SCB_WriteTxFifo(base, (uint32_t) buffer[idx]);
+        ++idx;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_WriteArray8
+****************************************************************************//**
+*
+* Places an array of 8-bit data elements in the SCB transmit FIFO.
+* This function does not block. It returns how many data elements were
+* placed in the transmit FIFO. The data width is not read from the hardware.
+*
+* \param base
+* The pointer to the SCB instance.
+*
+* \param buffer
+* The pointer to data to place in the transmit FIFO.
+*
+* \param size
+* The number of data elements to transmit.
+*
+* \return
+* The number of data elements placed in the transmit FIFO.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_WriteArray8(CySCB_Type *base, uint8_t const buffer[], uint32_t size)
+{
+    /* Get free entries in TX FIFO */
+    uint32_t numToCopy = Cy_SCB_GetFifoSize(base) - Cy_SCB_GetNumInTxFifo(base);
+
+    /* Adjust the data elements to write */
+    if (numToCopy > size)
+    {
+        numToCopy = size;
+    }
+
+    Cy_SCB_WriteArrayNoCheck8(base, buffer, numToCopy);
+
+    return (numToCopy);
+}
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_ezi2c.c
-* \version 1.0
+* \version 1.10
 *
 * Provides EZI2C API implementation of the SCB driver.
 *
@@ -38,6 +38,7 @@ extern "C" {
 static void HandleErrors      (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 static void HandleAddress     (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 static void UpdateRxFifoLevel (CySCB_Type *base, uint32_t bufSize);
+static uint32_t GetNumRxData  (CySCB_Type const *base);
 static void HandleDataReceive (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 static void HandleDataTransmit(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 static void HandleStop        (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
@@ -128,10 +129,12 @@ cy_en_scb_ezi2c_status_t Cy_SCB_EZI2C_Init(CySCB_Type *base, cy_stc_scb_ezi2c_co
     context->buf1Size      = 0UL;
     context->buf1rwBondary = 0UL;
     context->baseAddr1     = 0UL;
+    context->buf1Pending   = NULL;
 
-    context->buf1Size      = 0UL;
-    context->buf1rwBondary = 0UL;
+    context->buf2Size      = 0UL;
+    context->buf2rwBondary = 0UL;
     context->baseAddr2     = 0UL;
+    context->buf2Pending   = NULL;
 
     return CY_SCB_EZI2C_SUCCESS;
 }
@@ -204,6 +207,19 @@ void Cy_SCB_EZI2C_Disable(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
     /* Set the state to default and clear the statuses */
     context->status = 0UL;
     context->state  = CY_SCB_EZI2C_STATE_IDLE;
+
+    /* Expose the published buffers */
+    if (NULL != context->buf1Pending)
+    {
+        context->buf1        = context->buf1Pending;
+        context->buf1Pending = NULL;
+    }
+
+    if (NULL != context->buf2Pending)
+    {
+        context->buf2        = context->buf2Pending;
+        context->buf2Pending = NULL;
+    }
 }
 
 
@@ -626,6 +642,65 @@ void Cy_SCB_EZI2C_SetBuffer1(CySCB_Type const *base, uint8_t *buffer, uint32_t s
     context->buf1          = buffer;
     context->buf1Size      = size;
     context->buf1rwBondary = rwBoundary;
+    context->buf1Pending   = NULL;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_EZI2C_PublishBuffer1
+****************************************************************************//**
+*
+* Replaces the data buffer exposed to the I2C master on the primary
+* slave address request. If the EZI2C slave is not in a transaction, the buffer
+* is exposed immediately. Otherwise, the buffer is exposed after the current
+* transaction completes, so the master never reads a mix of the old and new
+* buffer content.
+* Use this function to update a multi-byte data without a critical section:
+* fill a back buffer and publish it. The previously exposed buffer can be
+* reused after \ref Cy_SCB_EZI2C_IsPublishPending returns false.
+*
+* \param base
+* The pointer to the EZI2C SCB instance.
+*
+* \param buffer
+* The pointer to the data buffer. The size and the Read/Write boundary
+* provided by \ref Cy_SCB_EZI2C_SetBuffer1 apply to this buffer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_ezi2c_context_t
+* allocated by the user. The structure is used during the EZI2C operation for
+* internal configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \note
+* The data written by the master into the previously exposed buffer is not
+* copied to the published buffer. Check \ref Cy_SCB_EZI2C_GetActivity for
+* the write status before publishing the buffer if the master writes data.
+*
+*******************************************************************************/
+void Cy_SCB_EZI2C_PublishBuffer1(CySCB_Type const *base, uint8_t *buffer, cy_stc_scb_ezi2c_context_t *context)
+{
+    CY_ASSERT_L1(NULL != buffer);
+
+    uint32_t intrState;
+
+    /* Suppress a compiler warning about unused variables */
+    (void) base;
+
+    intrState = Cy_SysLib_EnterCriticalSection();
+
+    if (CY_SCB_EZI2C_STATE_IDLE == context->state)
+    {
+        context->buf1        = buffer;
+        context->buf1Pending = NULL;
+    }
+    else
+    {
+        /* Expose the buffer on the transaction completion */
+        context->buf1Pending = buffer;
+    }
+
+    Cy_SysLib_ExitCriticalSection(intrState);
 }
 
 
@@ -737,6 +812,95 @@ void Cy_SCB_EZI2C_SetBuffer2(CySCB_Type const *base, uint8_t *buffer, uint32_t s
     context->buf2          = buffer;
     context->buf2Size      = size;
     context->buf2rwBondary = rwBoundary;
+    context->buf2Pending   = NULL;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_EZI2C_PublishBuffer2
+****************************************************************************//**
+*
+* Replaces the data buffer exposed to the I2C master on the secondary
+* slave address request. If the EZI2C slave is not in a transaction, the buffer
+* is exposed immediately. Otherwise, the buffer is exposed after the current
+* transaction completes, so the master never reads a mix of the old and new
+* buffer content.
+* Use this function to update a multi-byte data without a critical section:
+* fill a back buffer and publish it. The previously exposed buffer can be
+* reused after \ref Cy_SCB_EZI2C_IsPublishPending returns false.
+*
+* \param base
+* The pointer to the EZI2C SCB instance.
+*
+* \param buffer
+* The pointer to the data buffer. The size and the Read/Write boundary
+* provided by \ref Cy_SCB_EZI2C_SetBuffer2 apply to this buffer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_ezi2c_context_t
+* allocated by the user. The structure is used during the EZI2C operation for
+* internal configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \note
+* The data written by the master into the previously exposed buffer is not
+* copied to the published buffer. Check \ref Cy_SCB_EZI2C_GetActivity for
+* the write status before publishing the buffer if the master writes data.
+*
+*******************************************************************************/
+void Cy_SCB_EZI2C_PublishBuffer2(CySCB_Type const *base, uint8_t *buffer, cy_stc_scb_ezi2c_context_t *context)
+{
+    CY_ASSERT_L1(NULL != buffer);
+
+    uint32_t intrState;
+
+    /* Suppress a compiler warning about unused variables */
+    (void) base;
+
+    intrState = Cy_SysLib_EnterCriticalSection();
+
+    if (CY_SCB_EZI2C_STATE_IDLE == context->state)
+    {
+        context->buf2        = buffer;
+        context->buf2Pending = NULL;
+    }
+    else
+    {
+        /* Expose the buffer on the transaction completion */
+        context->buf2Pending = buffer;
+    }
+
+    Cy_SysLib_ExitCriticalSection(intrState);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_EZI2C_IsPublishPending
+****************************************************************************//**
+*
+* Checks whether any buffer published by \ref Cy_SCB_EZI2C_PublishBuffer1 or
+* \ref Cy_SCB_EZI2C_PublishBuffer2 waits for the completion of the current
+* transaction to be exposed to the I2C master.
+*
+* \param base
+* The pointer to the EZI2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_ezi2c_context_t
+* allocated by the user. The structure is used during the EZI2C operation for
+* internal configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* True if a published buffer is not exposed yet, false otherwise.
+*
+*******************************************************************************/
+bool Cy_SCB_EZI2C_IsPublishPending(CySCB_Type const *base, cy_stc_scb_ezi2c_context_t const *context)
+{
+    /* Suppress a compiler warning about unused variables */
+    (void) base;
+
+    return ((NULL != context->buf1Pending) || (NULL != context->buf2Pending));
 }
 
 
@@ -886,6 +1050,36 @@ static void HandleAddress(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
 {
     /* Default actions: ACK address 1 */
     uint32_t cmd = SCB_I2C_S_CMD_S_ACK_Msk;
+
+    if (CY_SCB_EZI2C_STATE_RX_DATA1 == context->state)
+    {
+        /* A ReStart ends the write: move the data bytes that are left in the
+        * RX FIFO to the buffer. For two addresses, the address byte follows them.
+        */
+        uint32_t numInFifo = ((0U != context->address2) ? GetNumRxData(base) : Cy_SCB_GetNumInRxFifo(base));
+        uint32_t numToCopy = ((numInFifo < context->bufSize) ? numInFifo : context->bufSize);
+
+        (void) Cy_SCB_ReadArray8(base, context->curBuf, numToCopy);
+        context->bufSize -= numToCopy;
+        context->curBuf  += numToCopy;
+
+        /* Drop the bytes that do not fit into the buffer */
+        for (numInFifo -= numToCopy; numInFifo > 0UL; --numInFifo)
+        {
+            (void) Cy_SCB_ReadRxFifo(base);
+        }
+
+        if (numToCopy > 0UL)
+        {
+            /* Update the base address to notice that the buffer is modified */
+            context->idx++;
+        }
+
+        /* The next write starts with the sub-address handled by firmware */
+        SCB_I2C_CTRL(base) &= (uint32_t) ~(SCB_I2C_CTRL_S_READY_DATA_ACK_Msk |
+                                           SCB_I2C_CTRL_S_NOT_READY_DATA_NACK_Msk);
+    }
+
     context->addr1Active = true;
 
     if (0U != context->address2)
@@ -1001,6 +1195,40 @@ static void UpdateRxFifoLevel(CySCB_Type *base, uint32_t bufSize)
 }
 
 
+/*******************************************************************************
+* Function Name: GetNumRxData
+****************************************************************************//**
+*
+* Returns the number of data bytes in the RX FIFO when the EZI2C slave is
+* configured to support two addresses. The address byte of the following
+* transaction is put into the RX FIFO after the data bytes and is not counted.
+*
+* \param base
+* The pointer to the EZI2C SCB instance.
+*
+* \return
+* The number of data bytes in the RX FIFO.
+*
+*******************************************************************************/
+static uint32_t GetNumRxData(CySCB_Type const *base)
+{
+    bool addrInFifo;
+    uint32_t numInFifo;
+
+    /* The slave stretches the clock after the address byte is received:
+    * the RX FIFO content does not change after the address match is set.
+    */
+    do
+    {
+        addrInFifo = (0UL != (CY_SCB_SLAVE_INTR_I2C_ADDR_MATCH & Cy_SCB_GetSlaveInterruptStatus(base)));
+        numInFifo  = Cy_SCB_GetNumInRxFifo(base);
+    }
+    while (addrInFifo != (0UL != (CY_SCB_SLAVE_INTR_I2C_ADDR_MATCH & Cy_SCB_GetSlaveInterruptStatus(base))));
+
+    return ((addrInFifo && (numInFifo > 0UL)) ? (numInFifo - 1UL) : numInFifo);
+}
+
+
 /*******************************************************************************
 * Function Name: HandleDataReceive
 ****************************************************************************//**
@@ -1101,7 +1329,7 @@ static void HandleDataReceive(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *cont
                     }
 
                     /* Choice receive scheme  */
-                    if ((0U != context->address2) || (context->bufSize < CY_SCB_EZI2C_FIFO_SIZE))
+                    if (context->bufSize < CY_SCB_EZI2C_FIFO_SIZE)
                     {
                         /* Handle each byte separately */
                         context->state = CY_SCB_EZI2C_STATE_RX_DATA0;
@@ -1151,8 +1379,21 @@ static void HandleDataReceive(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *cont
             /* Get the number of bytes to read from the RX FIFO */
             uint32_t numToCopy = Cy_SCB_GetRxFifoLevel(base) + 1UL;
 
+            if (0U != context->address2)
+            {
+                /* The address byte of the next transaction can follow the data
+                * in the RX FIFO. It is handled by HandleAddress.
+                */
+                numToCopy = GetNumRxData(base);
+
+                if (numToCopy > context->bufSize)
+                {
+                    numToCopy = context->bufSize;
+                }
+            }
+
             /* Get data from the RX FIFO */
-            numToCopy = Cy_SCB_ReadArray(base, context->curBuf, numToCopy);
+            numToCopy = Cy_SCB_ReadArray8(base, context->curBuf, numToCopy);
             context->bufSize -= numToCopy;
             context->curBuf  += numToCopy;
 
@@ -1192,7 +1433,7 @@ static void HandleDataTransmit(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *con
     if (context->bufSize > 0UL)
     {
         /* Write data into the TX FIFO from the buffer */
-        uint32_t numToCopy = Cy_SCB_WriteArray(base, context->curBuf, context->bufSize);
+        uint32_t numToCopy = Cy_SCB_WriteArray8(base, context->curBuf, context->bufSize);
         context->bufSize  -= numToCopy;
         context->curBuf   += numToCopy;
     }
@@ -1244,6 +1485,19 @@ static void HandleStop(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
                                            SCB_I2C_CTRL_S_NOT_READY_DATA_NACK_Msk);
     }
 
+    /* Expose the buffers published during the transaction */
+    if (NULL != context->buf1Pending)
+    {
+        context->buf1        = context->buf1Pending;
+        context->buf1Pending = NULL;
+    }
+
+    if (NULL != context->buf2Pending)
+    {
+        context->buf2        = context->buf2Pending;
+        context->buf2Pending = NULL;
+    }
+
     /* Update the statuses */
     context->status &= (uint32_t) ~CY_SCB_EZI2C_STATUS_BUSY;
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_i2c.c
-* \version 1.0
+* \version 1.10
 *
 * Provides I2C API implementation of the SCB driver.
 *
@@ -23,6 +23,7 @@
 *******************************************************************************/
 
 #include "cy_scb_i2c.h"
+#include "cy_systick.h"
 
 #ifdef CY_IP_M0S8SCB
 
@@ -30,6 +31,20 @@
 extern "C" {
 #endif
 
+/***************************************
+*        Internal Types
+***************************************/
+
+/* Tracks the timeout of the blocking master functions */
+typedef struct
+{
+    cy_stc_systick_timeout_t sysTick;   /* The SysTick deadline */
+    uint32_t remain;                    /* The remaining 1 us delay units, when SysTick is not used */
+    bool     enabled;                   /* The timeout is not 0 */
+    bool     useSysTick;                /* The SysTick cycle count advances */
+} cy_stc_scb_i2c_timeout_t;
+
+
 /***************************************
 *        Function Prototypes
 ***************************************/
@@ -44,10 +59,13 @@ static void MasterHandleDataTransmit(CySCB_Type *base, cy_stc_scb_i2c_context_t
 static void MasterHandleDataReceive (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 static void MasterHandleStop        (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 static void MasterHandleComplete    (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+static bool MasterHandleNextMsg     (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+static cy_en_scb_i2c_status_t MasterStartMsg(CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 
 static cy_en_scb_i2c_status_t HandleStatus(CySCB_Type *base, uint32_t status,
                                            cy_stc_scb_i2c_context_t *context);
-static uint32_t WaitOneUnit(uint32_t *timeout);
+static void     StartTimeout(cy_stc_scb_i2c_timeout_t *timeout, uint32_t timeoutMs);
+static uint32_t CheckTimeout(cy_stc_scb_i2c_timeout_t *timeout);
 
 
 /*******************************************************************************
@@ -140,6 +158,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_Init(CySCB_Type *base, cy_stc_scb_i2c_config_t
     /* Master-specific */
     context->masterStatus     = 0UL;
     context->masterBufferIdx  = 0UL;
+    context->masterMsg        = NULL;
 
     /* Slave-specific */
     context->slaveStatus       = 0UL;
@@ -227,6 +246,7 @@ void Cy_SCB_I2C_Disable(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
     context->state        = CY_SCB_I2C_IDLE;
     context->masterStatus = 0UL;
     context->slaveStatus  = 0UL;
+    context->masterMsg    = NULL;
 }
 
 
@@ -1384,6 +1404,7 @@ void Cy_SCB_I2C_MasterAbortRead(CySCB_Type *base, cy_stc_scb_i2c_context_t *cont
 
             /* Cancel pending read operation if it was requested */
             context->masterPause = false;
+            context->masterMsg   = NULL;
         }
     }
     else
@@ -1402,6 +1423,7 @@ void Cy_SCB_I2C_MasterAbortRead(CySCB_Type *base, cy_stc_scb_i2c_context_t *cont
             context->masterStatus   = CY_SCB_I2C_MASTER_BUSY;
             context->masterNumBytes = 0UL;
             context->masterPause    = false;
+            context->masterMsg      = NULL;
 
             /* Enable master interrupt sources to catch Stop condition */
             Cy_SCB_SetMasterInterruptMask(base, CY_SCB_I2C_MASTER_INTR);
@@ -1622,6 +1644,7 @@ void Cy_SCB_I2C_MasterAbortWrite(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
 
         /* Cancel pending write operation if it was requested */
         context->masterPause = false;
+        context->masterMsg   = NULL;
     }
     else
     {
@@ -1639,6 +1662,7 @@ void Cy_SCB_I2C_MasterAbortWrite(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
             context->masterStatus   = CY_SCB_I2C_MASTER_BUSY;
             context->masterNumBytes = 0UL;
             context->masterPause    = false;
+            context->masterMsg      = NULL;
 
             /* Enable master interrupt sources to catch Stop condition */
             Cy_SCB_SetMasterInterruptMask(base, CY_SCB_I2C_MASTER_INTR);
@@ -1653,6 +1677,97 @@ void Cy_SCB_I2C_MasterAbortWrite(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SCB_I2C_MasterTransfer
+****************************************************************************//**
+*
+* This function configures the master to automatically execute a sequence of
+* read and write messages as one transaction. The first message starts with
+* a Start condition, each following message starts with a ReStart condition,
+* and a Stop condition is generated after the last message. After the
+* transaction is initiated by this function it returns and
+* \ref Cy_SCB_I2C_Interrupt manages further data transfer and the conditions
+* between the messages.
+*
+* When the transaction is completed (all messages are transferred or
+* error occurred) the \ref CY_SCB_I2C_MASTER_BUSY status is cleared and
+* the \ref CY_SCB_I2C_MASTER_RD_CMPLT_EVENT or
+* \ref CY_SCB_I2C_MASTER_WR_CMPLT_EVENT event is generated depending on the
+* direction of the last transferred message. If the slave NAKs a message, the
+* transaction is terminated with a Stop condition and the remaining messages
+* are not transferred.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param msgs
+* The pointer to the array of messages \ref cy_stc_scb_i2c_master_msg_t.
+* Each message must transfer at least one byte.
+*
+* \param numMsgs
+* The number of messages in the array. \ref CY_SCB_I2C_BAD_PARAM is returned
+* if it is 0 or any message has no buffer or a zero size.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_i2c_status_t
+*
+* \note
+* * The array of messages and the buffers must not be modified and must stay
+*   allocated until the transaction completion.
+*
+* * \ref Cy_SCB_I2C_MasterGetTransferCount returns the number of bytes
+*   transferred by the last message.
+*
+* * The messages, except the last one, are read without the RX FIFO, the same
+*   way as \ref Cy_SCB_I2C_MasterRead with the xferPending option.
+*
+*******************************************************************************/
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterTransfer(CySCB_Type *base, cy_stc_scb_i2c_master_msg_t const *msgs,
+                                                 uint32_t numMsgs, cy_stc_scb_i2c_context_t *context)
+{
+    CY_ASSERT_L1(NULL != msgs);
+    CY_ASSERT_L2(numMsgs > 0UL);
+
+    cy_en_scb_i2c_status_t retStatus = CY_SCB_I2C_BAD_PARAM;
+    bool msgValid = (NULL != msgs) && (numMsgs > 0UL);
+    uint32_t msgIdx;
+
+    /* Every message must transfer data */
+    for (msgIdx = 0UL; msgValid && (msgIdx < numMsgs); ++msgIdx)
+    {
+        msgValid = CY_SCB_IS_BUFFER_VALID(msgs[msgIdx].buffer, msgs[msgIdx].bufferSize);
+    }
+
+    if (msgValid)
+    {
+        retStatus = CY_SCB_I2C_MASTER_NOT_READY;
+
+        if (0UL != (CY_SCB_I2C_IDLE_MASK & context->state))
+        {
+            /* Setup context */
+            context->masterMsg    = msgs;
+            context->masterMsgNum = numMsgs;
+            context->masterMsgIdx = 0UL;
+
+            retStatus = MasterStartMsg(base, context);
+
+            if (CY_SCB_I2C_SUCCESS != retStatus)
+            {
+                context->masterMsg = NULL;
+            }
+        }
+    }
+
+    return (retStatus);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SCB_I2C_MasterGetTransferCount
 ****************************************************************************//**
@@ -1754,7 +1869,9 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStart(CySCB_Type *base,
     if (CY_SCB_I2C_IDLE == context->state)
     {
         uint32_t locStatus;
-        uint32_t timeout = CY_SCB_I2C_CONVERT_TIMEOUT_TO_US(timeoutMs);
+        cy_stc_scb_i2c_timeout_t timeout;
+
+        StartTimeout(&timeout, timeoutMs);
 
         /* Set the read or write direction */
         context->state       = CY_SCB_I2C_MASTER_ADDR;
@@ -1774,7 +1891,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStart(CySCB_Type *base,
         {
             locStatus  = (CY_SCB_I2C_MASTER_TX_BYTE_DONE & Cy_SCB_GetMasterInterruptStatus(base));
             locStatus |= (CY_SCB_I2C_SLAVE_ADDR_DONE & Cy_SCB_GetSlaveInterruptStatus(base));
-            locStatus |= WaitOneUnit(&timeout);
+            locStatus |= CheckTimeout(&timeout);
 
         } while (0UL == locStatus);
 
@@ -1848,7 +1965,9 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendReStart(CySCB_Type *base,
     if (0UL != (CY_SCB_I2C_MASTER_ACTIVE & context->state))
     {
         uint32_t locStatus = 0U;
-        uint32_t timeout = CY_SCB_I2C_CONVERT_TIMEOUT_TO_US(timeoutMs);
+        cy_stc_scb_i2c_timeout_t timeout;
+
+        StartTimeout(&timeout, timeoutMs);
 
         /* Set the read or write direction */
         context->state       = CY_SCB_I2C_MASTER_ADDR;
@@ -1872,7 +1991,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendReStart(CySCB_Type *base,
             while ((0U == locStatus) &&
                    (0U != (SCB_I2C_M_CMD_M_START_Msk & SCB_I2C_M_CMD(base))))
             {
-                locStatus = WaitOneUnit(&timeout);
+                locStatus = CheckTimeout(&timeout);
             }
         }
 
@@ -1886,7 +2005,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendReStart(CySCB_Type *base,
             do
             {
                 locStatus  = (CY_SCB_I2C_MASTER_TX_BYTE_DONE & Cy_SCB_GetMasterInterruptStatus(base));
-                locStatus |= WaitOneUnit(&timeout);
+                locStatus |= CheckTimeout(&timeout);
 
             } while (0UL == locStatus);
         }
@@ -1945,7 +2064,9 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStop(CySCB_Type *base,uint32_t timeo
     if (0UL != (CY_SCB_I2C_MASTER_ACTIVE & context->state))
     {
         uint32_t locStatus;
-        uint32_t timeout = CY_SCB_I2C_CONVERT_TIMEOUT_TO_US(timeoutMs);
+        cy_stc_scb_i2c_timeout_t timeout;
+
+        StartTimeout(&timeout, timeoutMs);
 
         /* Generate a stop (for Write direction) and NACK plus stop for the Read direction */
         SCB_I2C_M_CMD(base) = (SCB_I2C_M_CMD_M_STOP_Msk | SCB_I2C_M_CMD_M_NACK_Msk);
@@ -1954,7 +2075,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStop(CySCB_Type *base,uint32_t timeo
         do
         {
             locStatus  = (CY_SCB_I2C_MASTER_STOP_DONE & Cy_SCB_GetMasterInterruptStatus(base));
-            locStatus |= WaitOneUnit(&timeout);
+            locStatus |= CheckTimeout(&timeout);
 
         } while (0UL == locStatus);
 
@@ -2024,14 +2145,16 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterReadByte(CySCB_Type *base,
     {
         bool     rxNotEmpty;
         uint32_t locStatus;
-        uint32_t timeout = CY_SCB_I2C_CONVERT_TIMEOUT_TO_US(timeoutMs);
+        cy_stc_scb_i2c_timeout_t timeout;
+
+        StartTimeout(&timeout, timeoutMs);
 
         /* Wait for ACK/NAK transmission and data byte reception */
         do
         {
             rxNotEmpty = (0UL != (CY_SCB_RX_INTR_NOT_EMPTY & Cy_SCB_GetRxInterruptStatus(base)));
             locStatus  = (CY_SCB_I2C_MASTER_RX_BYTE_DONE & Cy_SCB_GetMasterInterruptStatus(base));
-            locStatus |= WaitOneUnit(&timeout);
+            locStatus |= CheckTimeout(&timeout);
 
         } while ((!rxNotEmpty) && (0UL == locStatus));
 
@@ -2111,7 +2234,9 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWriteByte(CySCB_Type *base, uint8_t byte
     if (CY_SCB_I2C_MASTER_TX == context->state)
     {
         uint32_t locStatus;
-        uint32_t timeout = CY_SCB_I2C_CONVERT_TIMEOUT_TO_US(timeoutMs);
+        cy_stc_scb_i2c_timeout_t timeout;
+
+        StartTimeout(&timeout, timeoutMs);
 
         /* Send the data byte */
         Cy_SCB_WriteTxFifo(base, (uint32_t) byte);
@@ -2120,7 +2245,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWriteByte(CySCB_Type *base, uint8_t byte
         do
         {
             locStatus  = (CY_SCB_I2C_MASTER_TX_BYTE_DONE & Cy_SCB_GetMasterInterruptStatus(base));
-            locStatus |= WaitOneUnit(&timeout);
+            locStatus |= CheckTimeout(&timeout);
 
         } while (0UL == locStatus);
 
@@ -2438,7 +2563,7 @@ static void SlaveHandleDataReceive(CySCB_Type *base, cy_stc_scb_i2c_context_t *c
             uint32_t numToCopy = Cy_SCB_GetRxFifoLevel(base) + 1UL;
 
             /* Get data from RX FIFO */
-            numToCopy = Cy_SCB_ReadArray(base, context->slaveRxBuffer, numToCopy);
+            numToCopy = Cy_SCB_ReadArray8(base, context->slaveRxBuffer, numToCopy);
             context->slaveRxBufferIdx  += numToCopy;
             context->slaveRxBufferSize -= numToCopy;
             context->slaveRxBuffer      = &context->slaveRxBuffer[numToCopy];
@@ -2537,7 +2662,7 @@ static void SlaveHandleDataTransmit(CySCB_Type *base, cy_stc_scb_i2c_context_t *
             numToCopy = (context->useTxFifo) ? (context->slaveTxBufferSize - 1UL) : (1UL);
 
             /* Write data into TX FIFO */
-            numToCopy = Cy_SCB_WriteArray(base, context->slaveTxBuffer, numToCopy);
+            numToCopy = Cy_SCB_WriteArray8(base, context->slaveTxBuffer, numToCopy);
             context->slaveTxBufferIdx  += numToCopy;
             context->slaveTxBufferSize -= numToCopy;
             context->slaveTxBuffer      = &context->slaveTxBuffer[numToCopy];
@@ -2858,7 +2983,7 @@ static void MasterHandleDataReceive(CySCB_Type *base, cy_stc_scb_i2c_context_t *
             uint32_t numToCopied;
 
             /* Get data from RX FIFO */
-            numToCopied = Cy_SCB_ReadArray(base, context->masterBuffer, context->masterBufferSize);
+            numToCopied = Cy_SCB_ReadArray8(base, context->masterBuffer, context->masterBufferSize);
             context->masterBufferIdx  += numToCopied;
             context->masterBufferSize -= numToCopied;
             context->masterBuffer      = &context->masterBuffer[numToCopied];
@@ -2931,7 +3056,7 @@ static void MasterHandleDataTransmit(CySCB_Type *base, cy_stc_scb_i2c_context_t
             uint32_t NumToCopy = (context->useTxFifo) ? (context->masterBufferSize - 1UL) : (1UL);
 
             /* Write data into TX FIFO */
-            NumToCopy = Cy_SCB_WriteArray(base, context->masterBuffer, NumToCopy);
+            NumToCopy = Cy_SCB_WriteArray8(base, context->masterBuffer, NumToCopy);
             context->masterBufferIdx  += NumToCopy;
             context->masterBufferSize -= NumToCopy;
             context->masterBuffer      = &context->masterBuffer[NumToCopy];
@@ -3056,6 +3181,7 @@ static void MasterHandleStop(CySCB_Type *base, cy_stc_scb_i2c_context_t *context
 *******************************************************************************/
 static void MasterHandleComplete(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
 {
+    bool xferDone = true;
     uint32_t masterIntrStatus = Cy_SCB_GetMasterInterruptStatusMasked(base);
 
     /* Clean-up hardware */
@@ -3124,8 +3250,14 @@ static void MasterHandleComplete(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
         context->state = (context->masterPause) ? CY_SCB_I2C_MASTER_WAIT : CY_SCB_I2C_IDLE;
     }
 
+    /* Continue the transaction started by Cy_SCB_I2C_MasterTransfer */
+    if (NULL != context->masterMsg)
+    {
+        xferDone = MasterHandleNextMsg(base, context);
+    }
+
     /* An operation completion callback */
-    if (NULL != context->cbEvents)
+    if ((xferDone) && (NULL != context->cbEvents))
     {
         /* Get completion events based on the hardware status */
         uint32_t locEvents = context->masterRdDir ? CY_SCB_I2C_MASTER_RD_CMPLT_EVENT : CY_SCB_I2C_MASTER_WR_CMPLT_EVENT;
@@ -3138,32 +3270,182 @@ static void MasterHandleComplete(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
 }
 
 
+/*******************************************************************************
+* Function Name: MasterHandleNextMsg
+****************************************************************************//**
+*
+* Starts the next message of the transaction provided by
+* \ref Cy_SCB_I2C_MasterTransfer using a ReStart condition, or generates a Stop
+* condition to terminate the transaction when the current message has failed.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* True if the transaction is complete and false if it continues.
+*
+*******************************************************************************/
+static bool MasterHandleNextMsg(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    bool xferDone = true;
+
+    /* The master keeps the bus only between the messages */
+    if (CY_SCB_I2C_MASTER_WAIT == context->state)
+    {
+        if (0UL == (CY_SCB_I2C_MASTER_ERR & context->masterStatus))
+        {
+            ++context->masterMsgIdx;
+
+            xferDone = (CY_SCB_I2C_SUCCESS != MasterStartMsg(base, context));
+        }
+        else if (0UL == (CY_SCB_I2C_MASTER_ABORT_START & context->masterStatus))
+        {
+            /* The message has failed: keep the error status, and release
+            * the bus generating Stop.
+            */
+            context->masterStatus |= CY_SCB_I2C_MASTER_BUSY;
+            context->masterPause   = false;
+
+            /* Enable master interrupt sources to catch Stop condition */
+            Cy_SCB_SetMasterInterruptMask(base, CY_SCB_I2C_MASTER_INTR);
+
+            /* Complete transaction generating Stop */
+            SCB_I2C_M_CMD(base) = (SCB_I2C_M_CMD_M_STOP_Msk | SCB_I2C_M_CMD_M_NACK_Msk);
+            context->state  = CY_SCB_I2C_MASTER_WAIT_STOP;
+
+            xferDone = false;
+        }
+        else
+        {
+            /* The master does not own the bus */
+            context->state = CY_SCB_I2C_IDLE;
+        }
+    }
+
+    if (xferDone)
+    {
+        context->masterMsg = NULL;
+    }
+
+    return (xferDone);
+}
+
+
+/*******************************************************************************
+* Function Name: MasterStartMsg
+****************************************************************************//**
+*
+* Starts the current message of the transaction provided by
+* \ref Cy_SCB_I2C_MasterTransfer. All messages except the last one are pending,
+* so the next message starts with a ReStart condition.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_i2c_status_t
+*
+*******************************************************************************/
+static cy_en_scb_i2c_status_t MasterStartMsg(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    cy_en_scb_i2c_status_t retStatus;
+    cy_stc_scb_i2c_master_msg_t const *msg = &context->masterMsg[context->masterMsgIdx];
+    cy_stc_scb_i2c_master_xfer_config_t xferConfig;
+
+    xferConfig.slaveAddress = msg->slaveAddress;
+    xferConfig.buffer       = msg->buffer;
+    xferConfig.bufferSize   = msg->bufferSize;
+    xferConfig.xferPending  = ((context->masterMsgIdx + 1UL) < context->masterMsgNum);
+
+    if (CY_SCB_I2C_READ_XFER == msg->direction)
+    {
+        retStatus = Cy_SCB_I2C_MasterRead(base, &xferConfig, context);
+    }
+    else
+    {
+        retStatus = Cy_SCB_I2C_MasterWrite(base, &xferConfig, context);
+    }
+
+    return (retStatus);
+}
+
+
 
 /******************************************************************************
-* Function Name: WaitOneUnit
+* Function Name: StartTimeout
 ****************************************************************************//**
 *
-* Waits for one unit before unblock code execution.
+* Starts tracking the timeout of a blocking master function.
+* When \ref Cy_SysTick_IsTimeBaseRunning returns true, the timeout is a
+* SysTick deadline and the status is polled without delays. Otherwise, the
+* time is counted in 1 us delay units.
+*
+* \param timeout
+* The pointer to the timeout tracking structure.
+*
+* \param timeoutMs
+* The timeout in milliseconds. 0 means wait forever.
+*
+*******************************************************************************/
+static void StartTimeout(cy_stc_scb_i2c_timeout_t *timeout, uint32_t timeoutMs)
+{
+    timeout->enabled    = (0UL != timeoutMs);
+    timeout->useSysTick = Cy_SysTick_IsTimeBaseRunning();
+    timeout->remain     = CY_SCB_I2C_CONVERT_TIMEOUT_TO_US(timeoutMs);
+
+    if (timeout->enabled && timeout->useSysTick)
+    {
+        Cy_SysTick_TimeoutStart(&timeout->sysTick, timeout->remain);
+    }
+}
+
+
+/******************************************************************************
+* Function Name: CheckTimeout
+****************************************************************************//**
+*
+* Checks whether the timeout has expired.
 * Note that if a timeout value is 0, this function does nothing and returns 0.
 *
 * \param timeout
-* The pointer to a timeout value.
+* The pointer to the timeout tracking structure.
 *
 * \return
 * Returns 0 if a timeout does not expire or the timeout mask.
 *
 *******************************************************************************/
-static uint32_t WaitOneUnit(uint32_t *timeout)
+static uint32_t CheckTimeout(cy_stc_scb_i2c_timeout_t *timeout)
 {
     uint32_t status = 0UL;
 
     /* If the timeout equal to 0. Ignore the timeout */
-    if (*timeout > 0UL)
+    if (timeout->enabled)
     {
-        Cy_SysLib_DelayUs(CY_SCB_WAIT_1_UNIT);
-        --(*timeout);
+        if (timeout->useSysTick)
+        {
+            timeout->enabled = !Cy_SysTick_TimeoutExpired(&timeout->sysTick);
+        }
+        else
+        {
+            Cy_SysLib_DelayUs(CY_SCB_WAIT_1_UNIT);
+            --timeout->remain;
+
+            timeout->enabled = (timeout->remain > 0UL);
+        }
 
-        if (0UL == *timeout)
+        if (!timeout->enabled)
         {
             status = CY_SCB_I2C_MASTER_TIMEOUT_DONE;
         }
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_spi.c
-* \version 1.0
+* \version 1.10
 *
 * Provides SPI API implementation of the SCB driver.
 *
@@ -33,6 +33,10 @@ extern "C" {
 /* Static functions */
 static void HandleTransmit(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
 static void HandleReceive (CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+static void HandleNextTransfer(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+static void StartTransfer(CySCB_Type *base, void *txBuffer, void *rxBuffer, uint32_t size,
+                          cy_stc_scb_spi_context_t *context);
+static bool IsNextDescChained(cy_stc_scb_spi_context_t const *context, uint32_t descIdx);
 static void DiscardArrayNoCheck(CySCB_Type const *base, uint32_t size);
 
 /*******************************************************************************
@@ -132,9 +136,18 @@ cy_en_scb_spi_status_t Cy_SCB_SPI_Init(CySCB_Type *base, cy_stc_scb_spi_config_t
     {
         context->status    = 0UL;
 
+        context->rxByteMode = (config->rxDataWidth <= CY_SCB_BYTE_WIDTH);
+        context->txByteMode = (config->txDataWidth <= CY_SCB_BYTE_WIDTH);
+
         context->txBufIdx  = 0UL;
         context->rxBufIdx  = 0UL;
 
+        context->xferDesc    = NULL;
+        context->xferDescNum = 0UL;
+        context->rxDescIdx   = 0UL;
+        context->txDescIdx   = 0UL;
+        context->xferSsDone  = false;
+
         context->cbEvents = NULL;
 
     #if !defined(NDEBUG)
@@ -225,6 +238,9 @@ void Cy_SCB_SPI_Disable(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 
         context->rxBufIdx  = 0UL;
         context->txBufIdx  = 0UL;
+
+        context->xferDesc    = NULL;
+        context->xferDescNum = 0UL;
     }
 
     /* Disable RX and TX interrupt sources for the slave because
@@ -609,52 +625,121 @@ cy_en_scb_spi_status_t Cy_SCB_SPI_Transfer(CySCB_Type *base, void *txBuffer, voi
     /* Check whether there are no active transfer requests */
     if (0UL == (CY_SCB_SPI_TRANSFER_ACTIVE & context->status))
     {
-        uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
-
         /* Set up the context */
         context->status    = CY_SCB_SPI_TRANSFER_ACTIVE;
 
-        context->txBuf     = txBuffer;
-        context->txBufSize = size;
-        context->txBufIdx =  0UL;
-
-        context->rxBuf     = rxBuffer;
-        context->rxBufSize = size;
+        context->txBufIdx  = 0UL;
         context->rxBufIdx  = 0UL;
 
-        /* Set the TX interrupt when half of FIFO was transmitted */
-        Cy_SCB_SetTxFifoLevel(base, fifoSize / 2UL);
+        context->xferDesc    = NULL;
+        context->xferDescNum = 0UL;
+        context->rxDescIdx   = 0UL;
+        context->txDescIdx   = 0UL;
+        context->xferSsDone  = false;
 
-        if (_FLD2BOOL(SCB_SPI_CTRL_MASTER_MODE, SCB_SPI_CTRL(base)))
-        {
-            /* Trigger an RX interrupt:
-            * - If the transfer size is equal to or less than FIFO, trigger at the end of the transfer.
-            * - If the transfer size is greater than FIFO, trigger 1 byte earlier than the TX interrupt.
-            */
-            Cy_SCB_SetRxFifoLevel(base, (size > fifoSize) ? ((fifoSize / 2UL) - 2UL) : (size - 1UL));
+        StartTransfer(base, txBuffer, rxBuffer, size, context);
 
-            Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+        retStatus = CY_SCB_SPI_SUCCESS;
+    }
 
-            /* Enable interrupt sources to perform a transfer */
-            Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL);
-            Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
-        }
-        else
+    return (retStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_SPI_TransferQueue
+****************************************************************************//**
+*
+* Starts a sequence of SPI master transfers described by the list of
+* transfer descriptors. Each descriptor provides the transmit and receive
+* buffers, the number of data elements to transfer, and the slave select line.
+* The transfers are executed one after another by \ref Cy_SCB_SPI_Interrupt
+* without software intervention between them. If a descriptor has
+* keepSsAsserted set and the next descriptor uses the same slave select line,
+* data of the next descriptor is loaded into the TX FIFO right after the data
+* of the current one. Otherwise, the driver waits until the slave select is
+* de-asserted, sets the slave select line of the next descriptor, and
+* continues.
+* The status of the sequence is reported the same way as for
+* \ref Cy_SCB_SPI_Transfer: \ref CY_SCB_SPI_TRANSFER_IN_FIFO and
+* \ref CY_SCB_SPI_TRANSFER_IN_FIFO_EVENT are set after the data of the last
+* descriptor is loaded into the TX FIFO, and the
+* \ref CY_SCB_SPI_TRANSFER_CMPLT_EVENT is reported after the last descriptor is
+* complete. \ref Cy_SCB_SPI_GetNumTransfered returns the number of data
+* elements received over all descriptors.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param descList
+* The pointer to the array of transfer descriptors.
+* The array and the buffers it refers to must remain in scope until the
+* sequence is complete or aborted.
+*
+* \param numDesc
+* The number of descriptors in the array.
+* \ref CY_SCB_SPI_BAD_PARAM is returned if any descriptor has a zero size or
+* neither a transmit nor a receive buffer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_spi_status_t
+*
+* \note
+* This function is only supported in master mode. The slave select line
+* of the first descriptor is set by this function, therefore the SPI must
+* be idle when it is called.
+*
+*******************************************************************************/
+cy_en_scb_spi_status_t Cy_SCB_SPI_TransferQueue(CySCB_Type *base, cy_stc_scb_spi_xfer_desc_t const *descList,
+                                                uint32_t numDesc, cy_stc_scb_spi_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L1(CY_SCB_SPI_INIT_KEY == context->initKey);
+    CY_ASSERT_L1(NULL != descList);
+    CY_ASSERT_L2(numDesc > 0UL);
+
+    cy_en_scb_spi_status_t retStatus = CY_SCB_SPI_BAD_PARAM;
+    bool descValid = (numDesc > 0UL);
+    uint32_t descIdx;
+
+    /* Every descriptor must transfer data */
+    for (descIdx = 0UL; descValid && (descIdx < numDesc); ++descIdx)
+    {
+        descValid = CY_SCB_SPI_IS_BUFFER_VALID(descList[descIdx].txBuf, descList[descIdx].rxBuf,
+                                               descList[descIdx].size);
+    }
+
+    if (descValid && _FLD2BOOL(SCB_SPI_CTRL_MASTER_MODE, SCB_SPI_CTRL(base)))
+    {
+        retStatus = CY_SCB_SPI_TRANSFER_BUSY;
+
+        /* Check whether there are no active transfer requests */
+        if (0UL == (CY_SCB_SPI_TRANSFER_ACTIVE & context->status))
         {
-            /* Trigger an RX interrupt:
-            * - If the transfer size is equal to or less than half of FIFO, trigger ??at the end of the transfer.
-            * - If the transfer size is greater than half of FIFO, trigger 1 byte earlier than a TX interrupt.
-            */
-            Cy_SCB_SetRxFifoLevel(base, (size > (fifoSize / 2UL)) ? ((fifoSize / 2UL) - 2UL) : (size - 1UL));
+            /* Set up the context */
+            context->status    = CY_SCB_SPI_TRANSFER_ACTIVE;
 
-            Cy_SCB_SetSlaveInterruptMask(base, CY_SCB_SLAVE_INTR_SPI_BUS_ERROR);
+            context->txBufIdx  = 0UL;
+            context->rxBufIdx  = 0UL;
 
-            /* Enable interrupt sources to perform a transfer */
-            Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL | CY_SCB_RX_INTR_OVERFLOW);
-            Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL | CY_SCB_TX_INTR_UNDERFLOW);
-        }
+            context->xferDesc    = descList;
+            context->xferDescNum = numDesc;
+            context->rxDescIdx   = 0UL;
+            context->txDescIdx   = 0UL;
+            context->xferSsDone  = false;
 
-        retStatus = CY_SCB_SPI_SUCCESS;
+            Cy_SCB_SPI_SetActiveSlaveSelect(base, descList[0UL].slaveSelect);
+
+            StartTransfer(base, descList[0UL].txBuf, descList[0UL].rxBuf, descList[0UL].size, context);
+
+            retStatus = CY_SCB_SPI_SUCCESS;
+        }
     }
 
     return (retStatus);
@@ -699,6 +784,7 @@ void Cy_SCB_SPI_AbortTransfer(CySCB_Type *base, cy_stc_scb_spi_context_t *contex
 
     if (_FLD2BOOL(SCB_SPI_CTRL_MASTER_MODE, SCB_SPI_CTRL(base)))
     {
+        Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
         Cy_SCB_SetRxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
         Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
     }
@@ -713,7 +799,9 @@ void Cy_SCB_SPI_AbortTransfer(CySCB_Type *base, cy_stc_scb_spi_context_t *contex
     Cy_SCB_SPI_ClearRxFifo(base);
 
     /* Clear the status to allow a new transfer */
-    context->status = 0UL;
+    context->status      = 0UL;
+    context->xferDesc    = NULL;
+    context->xferDescNum = 0UL;
 }
 
 
@@ -860,11 +948,33 @@ void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
         Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_LEVEL);
     }
 
+    /* The master has de-asserted the slave select: continue with the next descriptor */
+    if (0UL != (CY_SCB_MASTER_INTR_SPI_DONE & Cy_SCB_GetMasterInterruptStatusMasked(base)))
+    {
+        Cy_SCB_ClearMasterInterrupt(base, CY_SCB_MASTER_INTR_SPI_DONE);
+
+        /* The event is also set when the TX FIFO runs empty in the middle of
+        * the descriptor. Wait for the event that follows the last data element.
+        */
+        if (!Cy_SCB_SPI_IsBusBusy(base) && Cy_SCB_IsTxComplete(base))
+        {
+            Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+            context->xferSsDone = true;
+        }
+    }
+
+    /* Start the next descriptor after both TX and RX of the current one are complete */
+    if (context->xferSsDone)
+    {
+        HandleNextTransfer(base, context);
+    }
+
     /* The transfer is complete: all data is loaded in the TX FIFO
-    * and all data is read from the RX FIFO
+    * and all data is read from the RX FIFO for the last descriptor
     */
     if ((0UL != (context->status & CY_SCB_SPI_TRANSFER_ACTIVE)) &&
-        (0UL == context->rxBufSize) && (0UL == context->txBufSize))
+        (0UL == context->rxBufSize) && (0UL == context->txBufSize) &&
+        ((context->rxDescIdx + 1UL) >= context->xferDescNum))
     {
         /* The transfer is complete */
         context->status &= (uint32_t) ~CY_SCB_SPI_TRANSFER_ACTIVE;
@@ -895,34 +1005,68 @@ void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 *******************************************************************************/
 static void HandleReceive(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 {
+    bool readNext;
+
     /* Get data in RX FIFO */
-    uint32_t numToCopy = Cy_SCB_GetNumInRxFifo(base);
+    uint32_t numInFifo = Cy_SCB_GetNumInRxFifo(base);
 
-    /* Adjust the number to read */
-    if (numToCopy > context->rxBufSize)
+    do
     {
-        numToCopy = context->rxBufSize;
-    }
+        uint32_t numToCopy = numInFifo;
+
+        /* Adjust the number to read */
+        if (numToCopy > context->rxBufSize)
+        {
+            numToCopy = context->rxBufSize;
+        }
 
-    /* Move the buffer */
-    context->rxBufIdx  += numToCopy;
-    context->rxBufSize -= numToCopy;
+        /* Move the buffer */
+        context->rxBufIdx  += numToCopy;
+        context->rxBufSize -= numToCopy;
+        numInFifo          -= numToCopy;
 
-    /* Read data from RX FIFO */
-    if (NULL != context->rxBuf)
-    {
-        uint8_t *buf = (uint8_t *) context->rxBuf;
+        /* Read data from RX FIFO */
+        if (NULL != context->rxBuf)
+        {
+            if (context->rxByteMode)
+            {
+                uint8_t *buf = (uint8_t *) context->rxBuf;
 
-        Cy_SCB_ReadArrayNoCheck(base, context->rxBuf, numToCopy);
+                Cy_SCB_ReadArrayNoCheck8(base, buf, numToCopy);
+                context->rxBuf = (void *) &buf[numToCopy];
+            }
+            else
+            {
+                uint16_t *buf = (uint16_t *) context->rxBuf;
 
-        buf = &buf[(Cy_SCB_IsRxDataWidthByte(base) ? (numToCopy) : (2UL * numToCopy))];
-        context->rxBuf = (void *) buf;
-    }
-    else
-    {
-        /* Discard read data. */
-        DiscardArrayNoCheck(base, numToCopy);
+                Cy_SCB_ReadArrayNoCheck16(base, buf, numToCopy);
+                context->rxBuf = (void *) &buf[numToCopy];
+            }
+        }
+        else
+        {
+            /* Discard read data. */
+            DiscardArrayNoCheck(base, numToCopy);
+        }
+
+        /* The transmit side has already moved to the chained descriptor:
+        * the rest of the RX FIFO data belongs to it.
+        */
+        readNext = ((0UL == context->rxBufSize) && (context->rxDescIdx < context->txDescIdx));
+
+        if (readNext)
+        {
+            uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
+
+            ++context->rxDescIdx;
+            context->rxBuf     = context->xferDesc[context->rxDescIdx].rxBuf;
+            context->rxBufSize = context->xferDesc[context->rxDescIdx].size;
+
+            Cy_SCB_SetRxFifoLevel(base, (context->rxBufSize > fifoSize) ?
+                                            ((fifoSize / 2UL) - 2UL) : (context->rxBufSize - 1UL));
+        }
     }
+    while (readNext && (numInFifo > 0UL));
 
     if (0UL == context->rxBufSize)
     {
@@ -960,49 +1104,235 @@ static void HandleReceive(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 *******************************************************************************/
 static void HandleTransmit(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 {
-    uint32_t numToCopy;
-    uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
+    bool loadNext;
+    uint32_t numFree = Cy_SCB_GetFifoSize(base) - Cy_SCB_GetNumInTxFifo(base);
+
+    do
+    {
+        uint32_t numToCopy = numFree;
+
+        /* Adjust the number to load */
+        if (numToCopy > context->txBufSize)
+        {
+            numToCopy = context->txBufSize;
+        }
 
-    numToCopy = fifoSize - Cy_SCB_GetNumInTxFifo(base);
+        /* Move the buffer */
+        context->txBufIdx  += numToCopy;
+        context->txBufSize -= numToCopy;
+        numFree            -= numToCopy;
+
+        /* Load TX FIFO with data */
+        if (NULL != context->txBuf)
+        {
+            if (context->txByteMode)
+            {
+                uint8_t *buf = (uint8_t *) context->txBuf;
+
+                Cy_SCB_WriteArrayNoCheck8(base, buf, numToCopy);
+                context->txBuf = (void *) &buf[numToCopy];
+            }
+            else
+            {
+                uint16_t *buf = (uint16_t *) context->txBuf;
+
+                Cy_SCB_WriteArrayNoCheck16(base, buf, numToCopy);
+                context->txBuf = (void *) &buf[numToCopy];
+            }
+        }
+        else
+        {
+            Cy_SCB_WriteDefaultArrayNoCheck(base, CY_SCB_SPI_DEFAULT_TX, numToCopy);
+        }
 
-    /* Adjust the number to load */
-    if (numToCopy > context->txBufSize)
+        /* Keep the slave select asserted: load data of the next descriptor */
+        loadNext = ((0UL == context->txBufSize) && IsNextDescChained(context, context->txDescIdx));
+
+        if (loadNext)
+        {
+            ++context->txDescIdx;
+            context->txBuf     = context->xferDesc[context->txDescIdx].txBuf;
+            context->txBufSize = context->xferDesc[context->txDescIdx].size;
+        }
+    }
+    while (loadNext && (numFree > 0UL));
+
+    if (0UL == context->txBufSize)
     {
-        numToCopy = context->txBufSize;
+        /* Disable the TX level interrupt */
+        Cy_SCB_SetTxInterruptMask(base, (Cy_SCB_GetTxInterruptMask(base) & (uint32_t) ~CY_SCB_TX_INTR_LEVEL));
+
+        if ((context->txDescIdx + 1UL) < context->xferDescNum)
+        {
+            /* Wait until the slave select is de-asserted to start the next descriptor */
+            Cy_SCB_ClearMasterInterrupt(base, CY_SCB_MASTER_INTR_SPI_DONE);
+            Cy_SCB_SetMasterInterruptMask(base, CY_SCB_MASTER_INTR_SPI_DONE);
+        }
+        else
+        {
+            /* Data is transferred into TX FIFO */
+            context->status |= CY_SCB_SPI_TRANSFER_IN_FIFO;
+
+            if (NULL != context->cbEvents)
+            {
+                context->cbEvents(CY_SCB_SPI_TRANSFER_IN_FIFO_EVENT);
+            }
+        }
     }
+}
 
-    /* Move the buffer */
-    context->txBufIdx  += numToCopy;
-    context->txBufSize -= numToCopy;
 
-    /* Load TX FIFO with data */
-    if (NULL != context->txBuf)
+/*******************************************************************************
+* Function Name: HandleNextTransfer
+****************************************************************************//**
+*
+* Reads the remaining data of the completed descriptor from RX FIFO and starts
+* the transfer of the next descriptor provided by \ref Cy_SCB_SPI_TransferQueue.
+* This function is called after the master has de-asserted the slave select.
+* If the received data is not complete yet, the RX level interrupt calls it
+* again.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void HandleNextTransfer(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
+{
+    /* All data of the descriptor has been received */
+    if (context->rxBufSize > 0UL)
+    {
+        HandleReceive(base, context);
+    }
+
+    if ((0UL == context->rxBufSize) && ((context->txDescIdx + 1UL) < context->xferDescNum))
     {
-        uint8_t *buf = (uint8_t *) context->txBuf;
+        cy_stc_scb_spi_xfer_desc_t const *desc;
+
+        context->xferSsDone = false;
+
+        ++context->txDescIdx;
+        context->rxDescIdx = context->txDescIdx;
 
-        Cy_SCB_WriteArrayNoCheck(base, context->txBuf, numToCopy);
+        desc = &context->xferDesc[context->txDescIdx];
 
-        buf = &buf[(Cy_SCB_IsTxDataWidthByte(base) ? (numToCopy) : (2UL * numToCopy))];
-        context->txBuf = (void *) buf;
+        Cy_SCB_SPI_SetActiveSlaveSelect(base, desc->slaveSelect);
+
+        StartTransfer(base, desc->txBuf, desc->rxBuf, desc->size, context);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: StartTransfer
+****************************************************************************//**
+*
+* Sets up the buffers, the FIFO levels, and enables the interrupt sources to
+* transfer one block of data.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param txBuffer
+* The pointer of the buffer with data to transmit.
+*
+* \param rxBuffer
+* The pointer to the buffer to store received data.
+*
+* \param size
+* The number of data elements to transmit and receive.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void StartTransfer(CySCB_Type *base, void *txBuffer, void *rxBuffer, uint32_t size,
+                          cy_stc_scb_spi_context_t *context)
+{
+    CY_ASSERT_L1(CY_SCB_SPI_IS_BUFFER_VALID(txBuffer, rxBuffer, size));
+
+    uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
+
+    context->txBuf     = txBuffer;
+    context->txBufSize = size;
+
+    context->rxBuf     = rxBuffer;
+    context->rxBufSize = size;
+
+    /* Set the TX interrupt when half of FIFO was transmitted */
+    Cy_SCB_SetTxFifoLevel(base, fifoSize / 2UL);
+
+    if (_FLD2BOOL(SCB_SPI_CTRL_MASTER_MODE, SCB_SPI_CTRL(base)))
+    {
+        /* Trigger an RX interrupt:
+        * - If the transfer size is equal to or less than FIFO, trigger at the end of the transfer.
+        * - If the transfer size is greater than FIFO, trigger 1 byte earlier than the TX interrupt.
+        */
+        Cy_SCB_SetRxFifoLevel(base, (size > fifoSize) ? ((fifoSize / 2UL) - 2UL) : (size - 1UL));
+
+        Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+
+        /* Enable interrupt sources to perform a transfer */
+        Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL);
+        Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
     }
     else
     {
-        Cy_SCB_WriteDefaultArrayNoCheck(base, CY_SCB_SPI_DEFAULT_TX, numToCopy);
+        /* Trigger an RX interrupt:
+        * - If the transfer size is equal to or less than half of FIFO, trigger ??at the end of the transfer.
+        * - If the transfer size is greater than half of FIFO, trigger 1 byte earlier than a TX interrupt.
+        */
+        Cy_SCB_SetRxFifoLevel(base, (size > (fifoSize / 2UL)) ? ((fifoSize / 2UL) - 2UL) : (size - 1UL));
+
+        Cy_SCB_SetSlaveInterruptMask(base, CY_SCB_SLAVE_INTR_SPI_BUS_ERROR);
+
+        /* Enable interrupt sources to perform a transfer */
+        Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL | CY_SCB_RX_INTR_OVERFLOW);
+        Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL | CY_SCB_TX_INTR_UNDERFLOW);
     }
+}
 
-    if (0UL == context->txBufSize)
-    {
-        /* Data is transferred into TX FIFO */
-        context->status |= CY_SCB_SPI_TRANSFER_IN_FIFO;
 
-        /* Disable the TX level interrupt */
-        Cy_SCB_SetTxInterruptMask(base, (Cy_SCB_GetTxInterruptMask(base) & (uint32_t) ~CY_SCB_TX_INTR_LEVEL));
+/*******************************************************************************
+* Function Name: IsNextDescChained
+****************************************************************************//**
+*
+* Checks whether the descriptor that follows the specified one must be
+* transferred without de-asserting the slave select.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \param descIdx
+* The index of the current descriptor.
+*
+* \return
+* True if the next descriptor is chained to the current one.
+*
+*******************************************************************************/
+static bool IsNextDescChained(cy_stc_scb_spi_context_t const *context, uint32_t descIdx)
+{
+    bool chained = false;
 
-        if (NULL != context->cbEvents)
-        {
-            context->cbEvents(CY_SCB_SPI_TRANSFER_IN_FIFO_EVENT);
-        }
+    if ((descIdx + 1UL) < context->xferDescNum)
+    {
+        cy_stc_scb_spi_xfer_desc_t const *desc = &context->xferDesc[descIdx];
+
+        chained = (desc->keepSsAsserted && (desc->slaveSelect == desc[1UL].slaveSelect));
     }
+
+    return (chained);
 }
 
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_uart.c
-* \version 1.0
+* \version 1.10
 *
 * Provides UART API implementation of the SCB driver.
 *
@@ -34,6 +34,7 @@ extern "C" {
 static void UartHandleDataReceive  (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 static void UartHandleRingBuffer   (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 static void UartHandleDataTransmit (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
+static void UartHandleTxRingBuffer (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 
 
 /*******************************************************************************
@@ -160,9 +161,14 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Init(CySCB_Type *base, cy_stc_scb_uart_confi
         context->rxStatus  = 0UL;
         context->txStatus  = 0UL;
 
+        context->byteMode  = (config->dataWidth <= CY_SCB_BYTE_WIDTH);
+
         context->rxRingBuf = NULL;
         context->rxRingBufSize = 0UL;
 
+        context->txRingBuf = NULL;
+        context->txRingBufSize = 0UL;
+
         context->rxBufIdx  = 0UL;
         context->txLeftToTransmit = 0UL;
 
@@ -536,7 +542,7 @@ uint32_t Cy_SCB_UART_GetNumInRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_
     }
     else
     {
-        size = (locHead + (context->rxBufSize - context->rxRingBufTail));
+        size = (locHead + (context->rxRingBufSize - context->rxRingBufTail));
     }
 
     return (size);
@@ -568,6 +574,359 @@ void Cy_SCB_UART_ClearRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_GetRingBufferReadSpan
+****************************************************************************//**
+*
+* Returns the location and the number of the oldest data elements in the ring
+* buffer that are stored contiguously in the ring buffer memory.
+* The data is not copied and is not removed from the ring buffer. Call
+* \ref Cy_SCB_UART_CommitRingBufferRead to release the processed data.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param span
+* The pointer to the location to store the address of the oldest data element
+* in the ring buffer. The element size is defined by the data type, which
+* depends on the configured data width. NULL is stored if the ring buffer
+* is empty.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* The number of contiguous data elements available at the returned location.
+*
+* \note
+* When the stored data wraps around the end of the ring buffer, only the
+* part up to the end of the ring buffer is returned. Call this function again
+* after \ref Cy_SCB_UART_CommitRingBufferRead to get the remaining part.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_GetRingBufferReadSpan(CySCB_Type const *base, void **span,
+                                           cy_stc_scb_uart_context_t const *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L1(NULL != span);
+
+    uint32_t numInBuf = Cy_SCB_UART_GetNumInRingBuffer(base, context);
+
+    *span = NULL;
+
+    if (numInBuf > 0UL)
+    {
+        /* The oldest data element follows the tail index */
+        uint32_t locTail = context->rxRingBufTail + 1UL;
+
+        if (locTail == context->rxRingBufSize)
+        {
+            locTail = 0UL;
+        }
+
+        /* Stop at the end of the ring buffer memory */
+        if (numInBuf > (context->rxRingBufSize - locTail))
+        {
+            numInBuf = (context->rxRingBufSize - locTail);
+        }
+
+        if (context->byteMode)
+        {
+            *span = (void *) &((uint8_t *) context->rxRingBuf)[locTail];
+        }
+        else
+        {
+            *span = (void *) &((uint16_t *) context->rxRingBuf)[locTail];
+        }
+    }
+
+    return (numInBuf);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_CommitRingBufferRead
+****************************************************************************//**
+*
+* Releases the data elements processed after
+* \ref Cy_SCB_UART_GetRingBufferReadSpan, so that the ring buffer can reuse
+* their memory.
+* If the ring buffer was full and receiving into it was stopped, this function
+* resumes it.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param size
+* The number of the oldest data elements to release. It must not be greater
+* than the number of data elements in the ring buffer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+void Cy_SCB_UART_CommitRingBufferRead(CySCB_Type *base, uint32_t size, cy_stc_scb_uart_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L2(size <= Cy_SCB_UART_GetNumInRingBuffer(base, context));
+
+    if (size > 0UL)
+    {
+        uint32_t locTail = context->rxRingBufTail + size;
+
+        if (locTail >= context->rxRingBufSize)
+        {
+            locTail -= context->rxRingBufSize;
+        }
+
+        /* Only the tail index is updated here, the interrupt updates the head */
+        context->rxRingBufTail = locTail;
+
+        /* Resume the ring buffer if it was stopped because it was full */
+        if ((NULL != context->rxRingBuf) &&
+            (0UL == (context->rxStatus & CY_SCB_UART_RECEIVE_ACTIVE)) &&
+            (0UL == Cy_SCB_GetRxInterruptMask(base)))
+        {
+            Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_StartTxRingBuffer
+****************************************************************************//**
+*
+* Starts the transmit ring buffer operation.
+* The data put into the ring buffer by \ref Cy_SCB_UART_PutTxRingBuffer is
+* copied into the TX FIFO by \ref Cy_SCB_UART_Interrupt, so that the
+* transmission continues without gaps while the producer keeps the ring buffer
+* filled. The \ref CY_SCB_UART_TRANSMIT_DONE_EVENT is generated each time the
+* ring buffer and the TX FIFO are drained and the last data element is sent.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param buffer
+* Pointer to the user defined ring buffer.
+* The element size is defined by the data type, which depends on the configured
+* data width.
+*
+* \param size
+* The size of the transmit ring buffer.
+* Note that one data element is used for internal use, so if the size is 32,
+* then only 31 data elements are used for data storage.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \note
+* * The buffer must not be modified and stay allocated while the ring buffer
+*   operates.
+* * This function changes the TX FIFO level. It must not be called while
+*   a transmit operation is active.
+* * The transmit ring buffer is not supported in the SmartCard mode.
+* * \ref Cy_SCB_UART_Transmit returns \ref CY_SCB_UART_TRANSMIT_BUSY while
+*   the transmit ring buffer operates.
+*
+*******************************************************************************/
+void Cy_SCB_UART_StartTxRingBuffer(CySCB_Type *base, void *buffer, uint32_t size, cy_stc_scb_uart_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L1(CY_SCB_UART_INIT_KEY == context->initKey);
+    CY_ASSERT_L1(CY_SCB_IS_BUFFER_VALID(buffer, size));
+    CY_ASSERT_L1(((uint32_t) CY_SCB_UART_SMARTCARD) != _FLD2VAL(SCB_UART_CTRL_MODE, SCB_UART_CTRL(base)));
+    CY_ASSERT_L2(0UL == (CY_SCB_UART_TRANSMIT_ACTIVE & context->txStatus));
+
+    if ((NULL != buffer) && (size > 0UL))
+    {
+        context->txRingBuf     = buffer;
+        context->txRingBufSize = size;
+        context->txRingBufHead = 0UL;
+        context->txRingBufTail = 0UL;
+
+        /* Refill the TX FIFO when it is half empty */
+        Cy_SCB_SetTxFifoLevel(base, (Cy_SCB_GetFifoSize(base) / 2UL));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_StopTxRingBuffer
+****************************************************************************//**
+*
+* Stops the transmit ring buffer operation. The data that is still in the
+* ring buffer is discarded. The data already in the TX FIFO is transmitted.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+void Cy_SCB_UART_StopTxRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
+{
+    Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+
+    context->txRingBuf     = NULL;
+    context->txRingBufSize = 0UL;
+    context->txRingBufHead = 0UL;
+    context->txRingBufTail = 0UL;
+
+    context->txStatus &= (uint32_t) ~CY_SCB_UART_TRANSMIT_ACTIVE;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_GetNumInTxRingBuffer
+****************************************************************************//**
+*
+* Returns the number of data elements in the transmit ring buffer that are not
+* yet copied into the TX FIFO.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* The number of data elements in the transmit ring buffer.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_GetNumInTxRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context_t const *context)
+{
+    uint32_t size;
+    uint32_t locTail = context->txRingBufTail;
+    uint32_t locHead = context->txRingBufHead;
+
+    /* Suppress a compiler warning about unused variables */
+    (void) base;
+
+    if (locHead >= locTail)
+    {
+        size = (locHead - locTail);
+    }
+    else
+    {
+        size = (locHead + (context->txRingBufSize - locTail));
+    }
+
+    return (size);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_PutTxRingBuffer
+****************************************************************************//**
+*
+* Copies data into the transmit ring buffer and enables the TX interrupt
+* source that moves it into the TX FIFO.
+*
+* Only this function updates the head index and only \ref Cy_SCB_UART_Interrupt
+* updates the tail index, so neither of them disables interrupts. This
+* function must be called from a single context that has a lower priority
+* than the UART interrupt.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param buffer
+* Pointer to the data to transmit.
+* The element size is defined by the data type, which depends on the configured
+* data width.
+*
+* \param size
+* The number of data elements to transmit.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* The number of data elements copied into the ring buffer. It is less than
+* size when the ring buffer does not have enough free space.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_PutTxRingBuffer(CySCB_Type *base, void const *buffer, uint32_t size, cy_stc_scb_uart_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L1(CY_SCB_IS_BUFFER_VALID(buffer, size));
+    CY_ASSERT_L2(NULL != context->txRingBuf);
+
+    uint32_t numToCopy = 0UL;
+
+    if (NULL != context->txRingBuf)
+    {
+        uint32_t idx;
+        uint32_t locHead = context->txRingBufHead;
+
+        numToCopy = (context->txRingBufSize - 1UL) - Cy_SCB_UART_GetNumInTxRingBuffer(base, context);
+
+        if (numToCopy > size)
+        {
+            numToCopy = size;
+        }
+
+        for (idx = 0UL; idx < numToCopy; ++idx)
+        {
+            ++locHead;
+
+            if (locHead == context->txRingBufSize)
+            {
+                locHead = 0UL;
+            }
+
+            if (context->byteMode)
+            {
+                ((uint8_t *) context->txRingBuf)[locHead] = ((uint8_t const *) buffer)[idx];
+            }
+            else
+            {
+                ((uint16_t *) context->txRingBuf)[locHead] = ((uint16_t const *) buffer)[idx];
+            }
+        }
+
+        if (numToCopy > 0UL)
+        {
+            /* Publish the data and set the status together, so the interrupt
+            * never sees new data without the active status or clears the
+            * status of data it has not sent. Keep the error bits.
+            */
+            uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+            context->txRingBufHead = locHead;
+            context->txStatus |= CY_SCB_UART_TRANSMIT_ACTIVE;
+
+            Cy_SysLib_ExitCriticalSection(interruptState);
+
+            /* The interrupt also writes the whole mask, never a read-modify-write of it */
+            Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+        }
+    }
+
+    return (numToCopy);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SCB_UART_Receive
 ****************************************************************************//**
@@ -640,7 +999,7 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Receive(CySCB_Type *base, void *buffer, uint
             {
                 uint32_t idx;
                 uint32_t locTail = context->rxRingBufTail;
-                bool     byteMode = Cy_SCB_IsRxDataWidthByte(base);
+                bool     byteMode = context->byteMode;
 
                 /* Adjust the number of items to be read */
                 if (numToCopy > locSize)
@@ -880,8 +1239,8 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Transmit(CySCB_Type *base, void *buffer, uin
 
     cy_en_scb_uart_status_t retStatus = CY_SCB_UART_TRANSMIT_BUSY;
 
-    /* Check whether there are no active transfer requests */
-    if (0UL == (CY_SCB_UART_TRANSMIT_ACTIVE & context->txStatus))
+    /* Check whether there are no active transfer requests and no transmit ring buffer */
+    if ((0UL == (CY_SCB_UART_TRANSMIT_ACTIVE & context->txStatus)) && (NULL == context->txRingBuf))
     {
         /* Set up context */
         context->txStatus  = CY_SCB_UART_TRANSMIT_ACTIVE;
@@ -1165,7 +1524,14 @@ void Cy_SCB_UART_Interrupt(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
         /* Load data to transmit */
         if (0UL != (CY_SCB_TX_INTR_LEVEL & Cy_SCB_GetTxInterruptStatusMasked(base)))
         {
-            UartHandleDataTransmit(base, context);
+            if (NULL != context->txRingBuf)
+            {
+                UartHandleTxRingBuffer(base, context);
+            }
+            else
+            {
+                UartHandleDataTransmit(base, context);
+            }
 
             Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_LEVEL);
         }
@@ -1173,15 +1539,31 @@ void Cy_SCB_UART_Interrupt(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
         /* Handle the TX complete */
         if (0UL != (CY_SCB_TX_INTR_UART_DONE & Cy_SCB_GetTxInterruptStatusMasked(base)))
         {
-            /* Disable all TX interrupt sources */
-            Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+            Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_UART_DONE);
+
+            if ((NULL != context->txRingBuf) && (0UL != Cy_SCB_UART_GetNumInTxRingBuffer(base, context)))
+            {
+                /* More data was put into the ring buffer after it was drained */
+                Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+            }
+            else if ((0UL == Cy_SCB_GetNumInTxFifo(base)) && (0UL == Cy_SCB_GetTxSrValid(base)))
+            {
+                /* Disable all TX interrupt sources */
+                Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
 
-            context->txStatus &= (uint32_t) ~CY_SCB_UART_TRANSMIT_ACTIVE;
-            context->txLeftToTransmit = 0UL;
+                context->txStatus &= (uint32_t) ~CY_SCB_UART_TRANSMIT_ACTIVE;
+                context->txLeftToTransmit = 0UL;
 
-            if (NULL != context->cbEvents)
+                if (NULL != context->cbEvents)
+                {
+                    context->cbEvents(CY_SCB_UART_TRANSMIT_DONE_EVENT);
+                }
+            }
+            else
             {
-                context->cbEvents(CY_SCB_UART_TRANSMIT_DONE_EVENT);
+                /* "TX done" was set by the previous data before the last data
+                * element was written. It is set again when the last one is sent.
+                */
             }
         }
 
@@ -1219,11 +1601,25 @@ void Cy_SCB_UART_Interrupt(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
 *******************************************************************************/
 static void UartHandleDataReceive(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
 {
-    uint32_t numCopied;
     uint32_t halfFifoSize = Cy_SCB_GetFifoSize(base) / 2UL;
 
+    /* Get available items in RX FIFO */
+    uint32_t numCopied = Cy_SCB_GetNumInRxFifo(base);
+
+    if (numCopied > context->rxBufSize)
+    {
+        numCopied = context->rxBufSize;
+    }
+
     /* Get data from RX FIFO */
-    numCopied = Cy_SCB_UART_GetArray(base, context->rxBuf, context->rxBufSize);
+    if (context->byteMode)
+    {
+        Cy_SCB_ReadArrayNoCheck8(base, (uint8_t *) context->rxBuf, numCopied);
+    }
+    else
+    {
+        Cy_SCB_ReadArrayNoCheck16(base, (uint16_t *) context->rxBuf, numCopied);
+    }
 
     /* Move the buffer */
     context->rxBufIdx  += numCopied;
@@ -1257,7 +1653,7 @@ static void UartHandleDataReceive(CySCB_Type *base, cy_stc_scb_uart_context_t *c
     {
         uint8_t *buf = (uint8_t *) context->rxBuf;
 
-        buf = &buf[(Cy_SCB_IsRxDataWidthByte(base) ? (numCopied) : (2UL * numCopied))];
+        buf = &buf[(context->byteMode) ? (numCopied) : (2UL * numCopied)];
         context->rxBuf = (void *) buf;
 
         if (context->rxBufSize < halfFifoSize)
@@ -1288,21 +1684,22 @@ static void UartHandleDataReceive(CySCB_Type *base, cy_stc_scb_uart_context_t *c
 static void UartHandleRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
 {
     uint32_t halfFifoSize = Cy_SCB_GetFifoSize(base) / 2UL;
-    uint32_t numToCopy = Cy_SCB_GetNumInRxFifo(base);
+    uint32_t numInFifo = Cy_SCB_GetNumInRxFifo(base);
     uint32_t locHead = context->rxRingBufHead;
-    uint32_t rxData;
+    uint32_t numToCopy;
 
     /* Get data into the ring buffer */
-    while (numToCopy > 0UL)
+    while (numInFifo > 0UL)
     {
-        ++locHead;
+        uint32_t locTail;
+        uint32_t nextIdx = locHead + 1UL;
 
-        if (locHead == context->rxRingBufSize)
+        if (nextIdx == context->rxRingBufSize)
         {
-            locHead = 0UL;
+            nextIdx = 0UL;
         }
 
-        if (locHead == context->rxRingBufTail)
+        if (nextIdx == context->rxRingBufTail)
         {
             /* The ring buffer is full, trigger a callback */
             if (NULL != context->cbEvents)
@@ -1311,35 +1708,40 @@ static void UartHandleRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *co
             }
 
             /* The ring buffer is still full. Disable the RX interrupt not to put data into the ring buffer.
-            * The data is stored in the RX FIFO until it overflows. Revert the head index.
+            * The data is stored in the RX FIFO until it overflows.
             */
-            if (locHead == context->rxRingBufTail)
+            if (nextIdx == context->rxRingBufTail)
             {
                 Cy_SCB_SetRxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
-
-                locHead = (locHead > 0UL) ? (locHead - 1UL) : (context->rxRingBufSize - 1UL);
                 break;
             }
         }
 
-        /* Get data from RX FIFO. */
-        rxData = Cy_SCB_ReadRxFifo(base);
+        /* Get the number of free entries that follow the head without a wrap */
+        locTail = context->rxRingBufTail;
+        numToCopy = (locTail > nextIdx) ? (locTail - nextIdx) : (context->rxRingBufSize - nextIdx);
+
+        if (numToCopy > numInFifo)
+        {
+            numToCopy = numInFifo;
+        }
 
-        /* Put a data item in the ring buffer */
-        if (Cy_SCB_IsRxDataWidthByte(base))
+        /* Get data from RX FIFO into the ring buffer */
+        if (context->byteMode)
         {
-            ((uint8_t *) context->rxRingBuf)[locHead] = (uint8_t) rxData;
+            Cy_SCB_ReadArrayNoCheck8(base, &((uint8_t *) context->rxRingBuf)[nextIdx], numToCopy);
         }
         else
         {
-            ((uint16_t *) context->rxRingBuf)[locHead] = (uint16_t) rxData;
+            Cy_SCB_ReadArrayNoCheck16(base, &((uint16_t *) context->rxRingBuf)[nextIdx], numToCopy);
         }
 
-        --numToCopy;
-    }
+        /* Update the head index */
+        locHead = nextIdx + numToCopy - 1UL;
+        context->rxRingBufHead = locHead;
 
-    /* Update the head index */
-    context->rxRingBufHead = locHead;
+        numInFifo -= numToCopy;
+    }
 
     /* Get free entries in the ring buffer */
     numToCopy = context->rxRingBufSize - Cy_SCB_UART_GetNumInRingBuffer(base, context);
@@ -1373,7 +1775,7 @@ static void UartHandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *
 {
     uint32_t numToCopy;
     uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
-    bool     byteMode = Cy_SCB_IsTxDataWidthByte(base);
+    bool     byteMode = context->byteMode;
 
     if (context->txBufSize > 1UL)
     {
@@ -1382,8 +1784,23 @@ static void UartHandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *
         /* Get the number of items left for transmission */
         context->txLeftToTransmit = context->txBufSize;
 
+        /* Get free entries in TX FIFO */
+        numToCopy = fifoSize - Cy_SCB_GetNumInTxFifo(base);
+
+        if (numToCopy > (context->txBufSize - 1UL))
+        {
+            numToCopy = (context->txBufSize - 1UL);
+        }
+
         /* Put data into TX FIFO */
-        numToCopy = Cy_SCB_UART_PutArray(base, context->txBuf, (context->txBufSize - 1UL));
+        if (byteMode)
+        {
+            Cy_SCB_WriteArrayNoCheck8(base, (uint8_t const *) context->txBuf, numToCopy);
+        }
+        else
+        {
+            Cy_SCB_WriteArrayNoCheck16(base, (uint16_t const *) context->txBuf, numToCopy);
+        }
 
         /* Move the buffer */
         context->txBufSize -= numToCopy;
@@ -1396,7 +1813,6 @@ static void UartHandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *
     if ((fifoSize != Cy_SCB_GetNumInTxFifo(base)) && (1UL == context->txBufSize))
     {
         uint32_t txData;
-        uint32_t intrStatus;
 
         context->txBufSize = 0UL;
 
@@ -1404,13 +1820,13 @@ static void UartHandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *
         txData = (uint32_t) ((byteMode) ? ((uint8_t *)  context->txBuf)[0UL] :
                                           ((uint16_t *) context->txBuf)[0UL]);
 
-        /* Put the last data element and make sure that "TX done" will happen for it */
-        intrStatus = Cy_SysLib_EnterCriticalSection();
-
-        Cy_SCB_WriteTxFifo(base, txData);
+        /* Clear "TX done" before the last data element is written, so it can
+        * only be set again after that element is sent or, if this code is
+        * preempted, by the previous data. The interrupt tells these cases
+        * apart by the TX FIFO and shifter state, so no critical section is needed.
+        */
         Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_UART_DONE);
-
-        Cy_SysLib_ExitCriticalSection(intrStatus);
+        Cy_SCB_WriteTxFifo(base, txData);
 
         /* Disable the level interrupt source and enable "transfer done" */
         Cy_SCB_SetTxInterruptMask(base, (CY_SCB_TX_INTR_UART_DONE |
@@ -1427,6 +1843,85 @@ static void UartHandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *
 }
 
 
+/*******************************************************************************
+* Function Name: UartHandleTxRingBuffer
+****************************************************************************//**
+*
+* Loads the transmit FIFO with data from the transmit ring buffer. When the
+* ring buffer is drained, the level interrupt source is replaced by
+* "transfer done".
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void UartHandleTxRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
+{
+    uint32_t numFree   = Cy_SCB_GetFifoSize(base) - Cy_SCB_GetNumInTxFifo(base);
+    uint32_t numInRing = Cy_SCB_UART_GetNumInTxRingBuffer(base, context);
+    uint32_t locTail   = context->txRingBufTail;
+    bool     drained   = (numInRing <= numFree);
+
+    /* Clear "TX done" before the last data element is written, see UartHandleDataTransmit */
+    if (drained && (numInRing > 0UL))
+    {
+        Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_UART_DONE);
+    }
+
+    while ((numInRing > 0UL) && (numFree > 0UL))
+    {
+        uint32_t numToCopy;
+        uint32_t nextIdx = locTail + 1UL;
+
+        if (nextIdx == context->txRingBufSize)
+        {
+            nextIdx = 0UL;
+        }
+
+        /* Get the number of data elements that follow the tail without a wrap */
+        numToCopy = context->txRingBufSize - nextIdx;
+
+        if (numToCopy > numInRing)
+        {
+            numToCopy = numInRing;
+        }
+
+        if (numToCopy > numFree)
+        {
+            numToCopy = numFree;
+        }
+
+        if (context->byteMode)
+        {
+            Cy_SCB_WriteArrayNoCheck8(base, &((uint8_t const *) context->txRingBuf)[nextIdx], numToCopy);
+        }
+        else
+        {
+            Cy_SCB_WriteArrayNoCheck16(base, &((uint16_t const *) context->txRingBuf)[nextIdx], numToCopy);
+        }
+
+        /* Update the tail index */
+        locTail = nextIdx + numToCopy - 1UL;
+        context->txRingBufTail = locTail;
+
+        numInRing -= numToCopy;
+        numFree   -= numToCopy;
+    }
+
+    if (drained)
+    {
+        /* Data put into the ring buffer from now on is picked up when "TX done" occurs */
+        Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_UART_DONE);
+    }
+}
+
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_sysclk.c
-* \version 1.0
+* \version 1.10
 *
 * Provides an API implementation of the sysclk driver.
 *
@@ -551,6 +551,207 @@ cy_en_sysclk_status_t Cy_SysClk_IloCompensate(uint32_t desiredDelay , uint32_t *
 }
 
 
+/* The ILO background calibration state */
+typedef struct
+{
+    uint32_t freqQ8;             /* The filtered ILO frequency, Hz * 2^8 */
+    uint32_t usPerCycleQ16;      /* The microseconds per ILO cycle * 2^16 */
+    uint32_t cyclesPerUsQ32;     /* The ILO cycles per microsecond * 2^32 */
+    uint32_t load;               /* The SysClk cycles of the running measurement, zero when idle */
+    uint32_t interval;           /* The number of the process calls between the measurements */
+    uint32_t count;              /* The number of the process calls since the last measurement */
+    bool valid;                  /* The estimate is based on at least one measurement */
+} cy_stc_sysclk_ilo_cal_t;
+
+#define ILO_CAL_FREQ_SHIFT               (8UL)
+#define ILO_CAL_US_PER_SEC               (1000000ULL)
+
+static cy_stc_sysclk_ilo_cal_t iloCal =
+{
+    CY_SYSCLK_ILO_FREQ << ILO_CAL_FREQ_SHIFT,
+    (uint32_t)((ILO_CAL_US_PER_SEC << 16U) / CY_SYSCLK_ILO_FREQ),
+    (uint32_t)(((uint64_t)CY_SYSCLK_ILO_FREQ << 32U) / ILO_CAL_US_PER_SEC),
+    0UL,
+    CY_SYSCLK_ILO_CAL_INTERVAL,
+    CY_SYSCLK_ILO_CAL_INTERVAL,
+    false
+};
+
+static void IloCalSetFactors(void);
+
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_IloCalInit
+****************************************************************************//**
+*
+* Initializes the ILO background calibration. The frequency estimate is reset
+* to the nominal \ref CY_SYSCLK_ILO_FREQ and the first call of
+* \ref Cy_SysClk_IloCalProcess starts a measurement.
+*
+* \param interval The number of \ref Cy_SysClk_IloCalProcess calls between
+* the end of a measurement and the start of the next one.
+*
+*******************************************************************************/
+void Cy_SysClk_IloCalInit(uint32_t interval)
+{
+    if (0UL != iloCal.load)
+    {
+        Cy_SysClk_IloStopMeasurement();
+    }
+
+    iloCal.load = 0UL;
+    iloCal.interval = interval;
+    iloCal.count = interval;
+    iloCal.valid = false;
+    iloCal.freqQ8 = CY_SYSCLK_ILO_FREQ << ILO_CAL_FREQ_SHIFT;
+
+    IloCalSetFactors();
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_IloCalProcess
+****************************************************************************//**
+*
+* Advances the ILO background calibration. The function does not wait: it
+* either starts a measurement, or completes the running one and updates the
+* ILO frequency estimate, or only counts the calls till the next measurement.
+*
+* \return
+* - \ref CY_SYSCLK_SUCCESS - No measurement is running.
+* - \ref CY_SYSCLK_STARTED - The measurement is running. Do not enter Deep Sleep
+*   until the function returns CY_SYSCLK_SUCCESS.
+*
+* \note SysClk should be sourced by IMO. Otherwise the results are incorrect.
+*
+*******************************************************************************/
+cy_en_sysclk_status_t Cy_SysClk_IloCalProcess(void)
+{
+    cy_en_sysclk_status_t retVal = CY_SYSCLK_SUCCESS;
+
+    if (0UL != iloCal.load)
+    {
+        if (0UL != (SRSSLT_TST_TRIM_CNTR1 & SRSSLT_TST_TRIM_CNTR1_COUNTER_DONE_Msk))
+        {
+            uint32_t iloCycles = SRSSLT_TST_TRIM_CNTR2;
+
+            if (0UL != iloCycles)
+            {
+                /* The measured frequency in Hz * 2^8 */
+                uint32_t measQ8 = (uint32_t)CY_SYSLIB_DIV_ROUND(((uint64_t)iloCycles * SystemCoreClock) << ILO_CAL_FREQ_SHIFT,
+                                                                (uint64_t)iloCal.load);
+
+                if (!iloCal.valid)
+                {
+                    iloCal.freqQ8 = measQ8;
+                    iloCal.valid = true;
+                }
+                else if (measQ8 > iloCal.freqQ8)
+                {
+                    iloCal.freqQ8 += (measQ8 - iloCal.freqQ8) >> CY_SYSCLK_ILO_CAL_FILTER;
+                }
+                else
+                {
+                    iloCal.freqQ8 -= (iloCal.freqQ8 - measQ8) >> CY_SYSCLK_ILO_CAL_FILTER;
+                }
+
+                IloCalSetFactors();
+            }
+
+            Cy_SysClk_IloStopMeasurement();
+            iloCal.load = 0UL;
+            iloCal.count = 0UL;
+        }
+        else
+        {
+            retVal = CY_SYSCLK_STARTED;
+        }
+    }
+    else if (iloCal.count < iloCal.interval)
+    {
+        iloCal.count++;
+    }
+    else
+    {
+        iloCal.load = SystemCoreClock >> SYS_CLK_DIVIDER;
+        Cy_SysClk_IloStartMeasurement();
+        SRSSLT_TST_TRIM_CNTR1 = iloCal.load;
+        retVal = CY_SYSCLK_STARTED;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: IloCalSetFactors
+****************************************************************************//**
+*
+* Recalculates the conversion factors for the ILO frequency estimate.
+*
+*******************************************************************************/
+static void IloCalSetFactors(void)
+{
+    iloCal.usPerCycleQ16 = (uint32_t)(((ILO_CAL_US_PER_SEC << (16UL + ILO_CAL_FREQ_SHIFT)) +
+                                       (iloCal.freqQ8 / 2UL)) / iloCal.freqQ8);
+    iloCal.cyclesPerUsQ32 = (uint32_t)((((uint64_t)iloCal.freqQ8 << (32UL - ILO_CAL_FREQ_SHIFT)) +
+                                        (ILO_CAL_US_PER_SEC / 2ULL)) / ILO_CAL_US_PER_SEC);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_IloCalGetFreq
+****************************************************************************//**
+*
+* Returns the filtered ILO frequency estimate.
+*
+* \return The ILO frequency in Hz.
+*
+*******************************************************************************/
+uint32_t Cy_SysClk_IloCalGetFreq(void)
+{
+    return ((iloCal.freqQ8 + (1UL << (ILO_CAL_FREQ_SHIFT - 1UL))) >> ILO_CAL_FREQ_SHIFT);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_IloCyclesToUs
+****************************************************************************//**
+*
+* Converts the number of the ILO cycles to microseconds using the filtered ILO
+* frequency estimate.
+*
+* \param cycles The number of the ILO cycles.
+*
+* \return The time in microseconds, saturated to 0xFFFFFFFF.
+*
+*******************************************************************************/
+uint32_t Cy_SysClk_IloCyclesToUs(uint32_t cycles)
+{
+    uint64_t us = (((uint64_t)cycles * iloCal.usPerCycleQ16) + 0x8000ULL) >> 16U;
+
+    return ((us > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)us);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_IloUsToCycles
+****************************************************************************//**
+*
+* Converts the time in microseconds to the number of the ILO cycles using the
+* filtered ILO frequency estimate.
+*
+* \param us The time in microseconds.
+*
+* \return The number of the ILO cycles.
+*
+*******************************************************************************/
+uint32_t Cy_SysClk_IloUsToCycles(uint32_t us)
+{
+    return ((uint32_t)((((uint64_t)us * iloCal.cyclesPerUsQ32) + 0x80000000ULL) >> 32U));
+}
+
+
 #if defined (CY_IP_M0S8EXCO) || defined(CY_DOXYGEN)
 /* ========================================================================== */
 /* ===========================    ECO SECTION    ============================ */
@@ -589,16 +790,11 @@ static uint32_t cy_sqrt(uint32_t x)
 
 static uint32_t ecoFreq = 0UL; /* Internal storage for ECO frequency user setting */
 
-#define CY_SYSCLK_ECO_FREQ_MIN (4000000UL)  /* 4 MHz */
-#define CY_SYSCLK_ECO_FREQ_MAX (33000000UL) /* 33 MHz */
-#define CY_SYSCLK_ECO_CLD_MAX  (100UL)      /* 100 pF */
-#define CY_SYSCLK_ECO_ESR_MAX  (1000UL)     /* 1000 Ohm */
-#define CY_SYSCLK_ECO_DRV_MAX  (2000UL)     /* 2 mW */
-
-#define CY_SYSCLK_ECO_IS_FREQ_VALID(freq) ((CY_SYSCLK_ECO_FREQ_MIN <= (freq)) && ((freq) <= CY_SYSCLK_ECO_FREQ_MAX))
-#define CY_SYSCLK_ECO_IS_CLD_VALID(cld)   ((0UL < (cld)) && ((cld) <= CY_SYSCLK_ECO_CLD_MAX))
-#define CY_SYSCLK_ECO_IS_ESR_VALID(esr)   ((0UL < (esr)) && ((esr) <= CY_SYSCLK_ECO_ESR_MAX))
-#define CY_SYSCLK_ECO_IS_DRV_VALID(drv)   ((0UL < (drv)) && ((drv) <= CY_SYSCLK_ECO_DRV_MAX))
+#define CY_SYSCLK_ECO_IS_TRIM_VALID(config) \
+    (((uint32_t)(config)->wdTrim <= (EXCO_ECO_TRIM0_WDTRIM_Msk >> EXCO_ECO_TRIM0_WDTRIM_Pos)) && \
+     ((uint32_t)(config)->aTrim  <= (EXCO_ECO_TRIM0_ATRIM_Msk  >> EXCO_ECO_TRIM0_ATRIM_Pos))  && \
+     ((uint32_t)(config)->fTrim  <= (EXCO_ECO_TRIM1_FTRIM_Msk  >> EXCO_ECO_TRIM1_FTRIM_Pos))  && \
+     ((uint32_t)(config)->gTrim  <= (EXCO_ECO_TRIM1_GTRIM_Msk  >> EXCO_ECO_TRIM1_GTRIM_Pos)))
 /** \endcond */
 
 
@@ -663,6 +859,11 @@ static uint32_t ecoFreq = 0UL; /* Internal storage for ECO frequency user settin
 *
 * \endverbatim
 *
+* \note
+* If the crystal characteristics are known at build time, use
+* \ref Cy_SysClk_EcoManualConfigure with \ref CY_SYSCLK_ECO_MANUAL_CONFIG
+* instead: it applies the same trim values without the run-time calculations.
+*
 * \funcusage
 * \snippet sysclk/snippet/main.c snippet_Cy_SysClk_EcoConfigure
 *
@@ -693,35 +894,28 @@ cy_en_sysclk_status_t Cy_SysClk_EcoConfigure(uint32_t freq, uint32_t cLoad, uint
 
         if ((maxAmpl >= 500UL) && (ampSect <= 3UL)) /* Error if input parameters cause erroneous intermediate values */
         {
-            uint32_t wdtrim = (maxAmpl < 1200UL) ? (5 * maxAmpl / 1000UL) - 2UL : 3UL;
-
-            uint32_t atrim = (maxAmpl < 600UL)  ? 0UL :
-                            ((maxAmpl < 700UL)  ? 1UL :
-                            ((maxAmpl < 800UL)  ? 2UL :
-                            ((maxAmpl < 900UL)  ? 3UL :
-                            ((maxAmpl < 1025UL) ? 4UL :
-                            ((maxAmpl < 1150UL) ? 5UL :
-                            ((maxAmpl < 1275UL) ? 6UL : 7UL))))));
+            cy_stc_sysclk_eco_manual_config_t config;
 
-            uint32_t ftrim = ((freq > 30000000UL) ? 0UL :
-                              ((freq > 24000000UL) ? 1UL :
-                               ((freq > 17000000UL) ? 2UL : 3UL)));
+            config.freq   = freq;
 
-            uint32_t gtrim = (ampSect > 1UL) ? ampSect :
-                            ((ampSect == 1UL) ? 0UL : 1UL);
+            config.wdTrim = (uint8_t)((maxAmpl < 1200UL) ? (5 * maxAmpl / 1000UL) - 2UL : 3UL);
 
-            EXCO_ECO_CONFIG = (maxAmpl < 2000UL) ? EXCO_ECO_CONFIG_AGC_EN_Msk : 0x0UL;
+            config.aTrim  = (uint8_t)((maxAmpl < 600UL)  ? 0UL :
+                                     ((maxAmpl < 700UL)  ? 1UL :
+                                     ((maxAmpl < 800UL)  ? 2UL :
+                                     ((maxAmpl < 900UL)  ? 3UL :
+                                     ((maxAmpl < 1025UL) ? 4UL :
+                                     ((maxAmpl < 1150UL) ? 5UL :
+                                     ((maxAmpl < 1275UL) ? 6UL : 7UL)))))));
 
-            EXCO_ECO_TRIM0 = _VAL2FLD(EXCO_ECO_TRIM0_WDTRIM, wdtrim) |
-                             _VAL2FLD(EXCO_ECO_TRIM0_ATRIM, atrim);
+            config.fTrim  = (uint8_t)CY_SYSCLK_ECO_FTRIM(freq);
 
-            EXCO_ECO_TRIM1 = _VAL2FLD(EXCO_ECO_TRIM1_FTRIM, ftrim) |
-                             _VAL2FLD(EXCO_ECO_TRIM1_RTRIM, ftrim) | /* rtrim = ftrim */
-                             _VAL2FLD(EXCO_ECO_TRIM1_GTRIM, gtrim);
+            config.gTrim  = (uint8_t)((ampSect > 1UL) ? ampSect :
+                                     ((ampSect == 1UL) ? 0UL : 1UL));
 
-            ecoFreq = freq; /* Store the ECO frequency */
+            config.agcEn  = (maxAmpl < 2000UL);
 
-            retVal = CY_SYSCLK_SUCCESS;
+            retVal = Cy_SysClk_EcoManualConfigure(&config);
         }
     }
     else
@@ -733,6 +927,60 @@ cy_en_sysclk_status_t Cy_SysClk_EcoConfigure(uint32_t freq, uint32_t cLoad, uint
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SysClk_EcoManualConfigure
+****************************************************************************//**
+*
+* Configures the external crystal oscillator (ECO) trim bits with the
+* pre-calculated values. This function should be called only when the ECO
+* is disabled.
+*
+* \param config \ref cy_stc_sysclk_eco_manual_config_t, usually initialized by
+* \ref CY_SYSCLK_ECO_MANUAL_CONFIG at build time.
+*
+* \return Error / status code \ref cy_en_sysclk_status_t : \n
+* CY_SYSCLK_SUCCESS - ECO configuration completed successfully \n
+* CY_SYSCLK_BAD_PARAM - One or more invalid parameters \n
+* CY_SYSCLK_INVALID_STATE - ECO already enabled
+*
+* \note
+* The function only checks the frequency and the trim value ranges, so
+* the crystal characteristics should be checked by
+* \ref CY_SYSCLK_ECO_IS_CONFIG_VALID.
+*
+*******************************************************************************/
+cy_en_sysclk_status_t Cy_SysClk_EcoManualConfigure(const cy_stc_sysclk_eco_manual_config_t *config)
+{
+    cy_en_sysclk_status_t retVal = CY_SYSCLK_BAD_PARAM;
+
+    if (Cy_SysClk_EcoIsEnabled())
+    {
+        retVal = CY_SYSCLK_INVALID_STATE;
+    }
+    else if ((CY_SYSCLK_ECO_IS_FREQ_VALID(config->freq)) && (CY_SYSCLK_ECO_IS_TRIM_VALID(config)))
+    {
+        EXCO_ECO_CONFIG = config->agcEn ? EXCO_ECO_CONFIG_AGC_EN_Msk : 0x0UL;
+
+        EXCO_ECO_TRIM0 = _VAL2FLD(EXCO_ECO_TRIM0_WDTRIM, config->wdTrim) |
+                         _VAL2FLD(EXCO_ECO_TRIM0_ATRIM,  config->aTrim);
+
+        EXCO_ECO_TRIM1 = _VAL2FLD(EXCO_ECO_TRIM1_FTRIM, config->fTrim) |
+                         _VAL2FLD(EXCO_ECO_TRIM1_RTRIM, config->fTrim) | /* rtrim = ftrim */
+                         _VAL2FLD(EXCO_ECO_TRIM1_GTRIM, config->gTrim);
+
+        ecoFreq = config->freq; /* Store the ECO frequency */
+
+        retVal = CY_SYSCLK_SUCCESS;
+    }
+    else
+    {
+        /* return CY_SYSCLK_BAD_PARAM */
+    }
+
+    return (retVal);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SysClk_EcoEnable
 ****************************************************************************//**
@@ -928,10 +1176,10 @@ cy_en_sysclk_status_t Cy_SysClk_PllSetSource(uint32_t pllNum, cy_en_sysclk_pll_s
 #define PLL_MAX_OUT_DIV  (3UL)
 
 /* Internal PLL frequencies ranges */
-#define PLL_MIN_FVCO     (22500000UL)
-#define PLL_MAX_FVCO     (104000000UL)
+#define PLL_MIN_FVCO     (CY_SYSCLK_PLL_MIN_FVCO)
+#define PLL_MAX_FVCO     (CY_SYSCLK_PLL_MAX_FVCO)
 #define PLL_MIN_FPFD     (1000000UL)
-#define PLL_MAX_FPFD     (3000000UL)
+#define PLL_MAX_FPFD     (CY_SYSCLK_PLL_MAX_FPFD)
 
 /* PLL input and output frequency limits */
 #define PLL_MIN_IN_FREQ  (1000000UL)
@@ -1024,51 +1272,62 @@ cy_en_sysclk_status_t Cy_SysClk_PllConfigure(uint32_t pllNum, const cy_stc_syscl
     {
         cy_stc_sysclk_pll_manual_config_t manualConfig = {0U, 0U, 0U, PLL_ICP_SEL_DEFAULT};
 
-        /* for each possible value of OUTPUT_DIV and REFERENCE_DIV (Q), try
-           to find a value for FEEDBACK_DIV (P) that gives an output frequency
-           as close as possible to the desired output frequency. */
-        uint32_t q, fpfd;
-        uint32_t foutBest = 0UL; /* to ensure at least one pass through the for loops below */
-
-        /* REFERENCE_DIV (Q) selection */
-        for (q = PLL_MIN_REF_DIV; (q <= PLL_MAX_REF_DIV) && (foutBest != (config->outputFreq)); q++)
+        if (CY_SYSCLK_PLL_IS_EXACT(inputFreq, config->outputFreq))
         {
-            fpfd = CY_SYSLIB_DIV_ROUND(inputFreq, 1UL + q);
-
-            if ((PLL_MIN_FPFD <= fpfd) && (fpfd <= PLL_MAX_FPFD))
+            /* Both frequencies are multiples of 1 MHz: calculate the exact
+               dividers directly instead of searching for them. */
+            manualConfig.feedbackDiv  = (uint8_t)CY_SYSCLK_PLL_FB_DIV(inputFreq, config->outputFreq);
+            manualConfig.referenceDiv = (uint8_t)CY_SYSCLK_PLL_REF_DIV(inputFreq, config->outputFreq);
+            manualConfig.outputDiv    = (uint8_t)CY_SYSCLK_PLL_OUT_DIV(config->outputFreq);
+        }
+        else
+        {
+            /* for each possible value of OUTPUT_DIV and REFERENCE_DIV (Q), try
+               to find a value for FEEDBACK_DIV (P) that gives an output frequency
+               as close as possible to the desired output frequency. */
+            uint32_t q, fpfd;
+            uint32_t foutBest = 0UL; /* to ensure at least one pass through the for loops below */
+
+            /* REFERENCE_DIV (Q) selection */
+            for (q = PLL_MIN_REF_DIV; (q <= PLL_MAX_REF_DIV) && (foutBest != (config->outputFreq)); q++)
             {
-                uint32_t p, fvco;
+                fpfd = CY_SYSLIB_DIV_ROUND(inputFreq, 1UL + q);
 
-                /* FEEDBACK_DIV (P) selection */
-                for (p = PLL_MIN_FB_DIV; (p <= PLL_MAX_FB_DIV) && (foutBest != (config->outputFreq)); p++)
+                if ((PLL_MIN_FPFD <= fpfd) && (fpfd <= PLL_MAX_FPFD))
                 {
-                    /* Calculate the intermediate Fvco, and make sure that it's in range */
-                    fvco = fpfd * p;
+                    uint32_t p, fvco;
 
-                    if ((PLL_MIN_FVCO <= fvco) && (fvco <= PLL_MAX_FVCO))
+                    /* FEEDBACK_DIV (P) selection */
+                    for (p = PLL_MIN_FB_DIV; (p <= PLL_MAX_FB_DIV) && (foutBest != (config->outputFreq)); p++)
                     {
-                        uint32_t out;
+                        /* Calculate the intermediate Fvco, and make sure that it's in range */
+                        fvco = fpfd * p;
 
-                        /* OUTPUT_DIV selection */
-                        for (out = PLL_MIN_OUT_DIV; (out <= PLL_MAX_OUT_DIV) && (foutBest != (config->outputFreq)); out++)
+                        if ((PLL_MIN_FVCO <= fvco) && (fvco <= PLL_MAX_FVCO))
                         {
-                            /* Calculate what output frequency will actually be produced.
-                               If it's closer to the target than what we have so far, then save it. */
-                            uint32_t fout = CY_SYSLIB_DIV_ROUND(fvco, 1UL << out);
+                            uint32_t out;
 
-                            if ((uint32_t)abs((int32_t)fout - (int32_t)(config->outputFreq)) <
-                                (uint32_t)abs((int32_t)foutBest - (int32_t)(config->outputFreq)))
+                            /* OUTPUT_DIV selection */
+                            for (out = PLL_MIN_OUT_DIV; (out <= PLL_MAX_OUT_DIV) && (foutBest != (config->outputFreq)); out++)
                             {
-                                foutBest = fout;
-                                manualConfig.feedbackDiv  = (uint8_t)p;
-                                manualConfig.referenceDiv = (uint8_t)q;
-                                manualConfig.outputDiv    = (uint8_t)out;
+                                /* Calculate what output frequency will actually be produced.
+                                   If it's closer to the target than what we have so far, then save it. */
+                                uint32_t fout = CY_SYSLIB_DIV_ROUND(fvco, 1UL << out);
+
+                                if ((uint32_t)abs((int32_t)fout - (int32_t)(config->outputFreq)) <
+                                    (uint32_t)abs((int32_t)foutBest - (int32_t)(config->outputFreq)))
+                                {
+                                    foutBest = fout;
+                                    manualConfig.feedbackDiv  = (uint8_t)p;
+                                    manualConfig.referenceDiv = (uint8_t)q;
+                                    manualConfig.outputDiv    = (uint8_t)out;
+                                }
                             }
                         }
                     }
                 }
-            }
-        } /* exit loops if foutBest equals outputFreq */
+            } /* exit loops if foutBest equals outputFreq */
+        }
 
         /* configure PLL based on calculated values */
         retVal = Cy_SysClk_PllManualConfigure(pllNum, &manualConfig);
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file  cy_sysint.c
-* \version 1.0
+* \version 1.10
 *
 * \brief
 * Provides an API implementation of the SysInt driver.
@@ -25,6 +25,22 @@
 
 #include "cy_sysint.h"
 
+#if (CY_SYSINT_PROFILE != 0U) && defined(CY_IP_M0S8TCPWM)
+
+/* The profiler timestamp counter */
+static volatile uint32_t const * profileCounter = NULL;
+
+/* The profiler statistics */
+static cy_stc_sysint_profile_t profileIsr[CY_SYSINT_PROFILE_IRQ_NUM];
+static cy_stc_sysint_profile_t profileCritical;
+
+/* The timestamp of the outermost critical section entry */
+static uint32_t profileCriticalStart;
+
+static void Cy_SysInt_ProfileRecord(cy_stc_sysint_profile_t *stats, uint32_t start);
+
+#endif /* (CY_SYSINT_PROFILE != 0U) && defined(CY_IP_M0S8TCPWM) */
+
 
 /*******************************************************************************
 * Function Name: Cy_SysInt_Init
@@ -164,4 +180,234 @@ cy_israddress Cy_SysInt_GetVector(IRQn_Type IRQn)
 }
 
 
+#if (CY_SYSINT_PROFILE != 0U) && defined(CY_IP_M0S8TCPWM)
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileInit
+****************************************************************************//**
+*
+* \brief Selects the profiler timestamp counter and clears the statistics.
+*
+* The counter must be configured by the application to count up continuously
+* with the period 0xFFFF and must be running before the profiler is used.
+*
+* \param base
+* The pointer to a TCPWM instance.
+*
+* \param cntNum
+* The Counter instance number in the selected TCPWM.
+*
+*******************************************************************************/
+void Cy_SysInt_ProfileInit(TCPWM_Type const *base, uint32_t cntNum)
+{
+    CY_ASSERT_L1(NULL != base);
+
+    profileCounter = &TCPWM_CNT_COUNTER(base, cntNum);
+    Cy_SysInt_ProfileReset();
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileReset
+****************************************************************************//**
+*
+* \brief Clears the profiler statistics of all interrupts and of the critical
+* sections.
+*
+*******************************************************************************/
+void Cy_SysInt_ProfileReset(void)
+{
+    uint32_t interruptState;
+    uint32_t idx;
+    uint32_t bin;
+
+    interruptState = (Cy_SysLib_EnterCriticalSection)();
+
+    for (idx = 0UL; idx <= CY_SYSINT_PROFILE_IRQ_NUM; idx++)
+    {
+        cy_stc_sysint_profile_t *stats = (idx < CY_SYSINT_PROFILE_IRQ_NUM) ? &profileIsr[idx] : &profileCritical;
+
+        stats->min   = (uint16_t) TCPWM_CNT_COUNTER_COUNTER_Msk;
+        stats->max   = 0U;
+        stats->count = 0UL;
+
+        for (bin = 0UL; bin < CY_SYSINT_PROFILE_HIST_BINS; bin++)
+        {
+            stats->hist[bin] = 0U;
+        }
+    }
+
+    (Cy_SysLib_ExitCriticalSection)(interruptState);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileIsrEnter
+****************************************************************************//**
+*
+* \brief Returns the ISR entry timestamp. Call it first in the ISR.
+*
+* \return
+* The timestamp to pass to \ref Cy_SysInt_ProfileIsrExit.
+*
+*******************************************************************************/
+uint32_t Cy_SysInt_ProfileIsrEnter(void)
+{
+    return ((NULL != profileCounter) ? *profileCounter : 0UL);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileIsrExit
+****************************************************************************//**
+*
+* \brief Records the duration of the current ISR. Call it last in the ISR.
+*
+* The statistics entry is selected by the active interrupt number. Calls from
+* system exception handlers and from interrupts at or above
+* \ref CY_SYSINT_PROFILE_IRQ_NUM are ignored.
+*
+* \param start
+* The timestamp returned by \ref Cy_SysInt_ProfileIsrEnter.
+*
+*******************************************************************************/
+void Cy_SysInt_ProfileIsrExit(uint32_t start)
+{
+    uint32_t exception = __get_IPSR();
+
+    if ((exception >= CY_INT_IRQ_BASE) && ((exception - CY_INT_IRQ_BASE) < CY_SYSINT_PROFILE_IRQ_NUM))
+    {
+        /* The same interrupt does not preempt itself, so no lock is needed */
+        Cy_SysInt_ProfileRecord(&profileIsr[exception - CY_INT_IRQ_BASE], start);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileEnterCritical
+****************************************************************************//**
+*
+* \brief Enters a critical section like \ref Cy_SysLib_EnterCriticalSection and
+* timestamps it if it is the outermost one.
+*
+* \return
+* The saved interrupt status to pass to \ref Cy_SysInt_ProfileExitCritical.
+*
+*******************************************************************************/
+uint32_t Cy_SysInt_ProfileEnterCritical(void)
+{
+    uint32_t savedIntrStatus = (Cy_SysLib_EnterCriticalSection)();
+
+    if (0UL == savedIntrStatus)
+    {
+        profileCriticalStart = Cy_SysInt_ProfileIsrEnter();
+    }
+
+    return (savedIntrStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileExitCritical
+****************************************************************************//**
+*
+* \brief Exits a critical section like \ref Cy_SysLib_ExitCriticalSection and
+* records its duration if it is the outermost one.
+*
+* \param savedIntrStatus
+* The value returned by \ref Cy_SysInt_ProfileEnterCritical.
+*
+*******************************************************************************/
+void Cy_SysInt_ProfileExitCritical(uint32_t savedIntrStatus)
+{
+    if (0UL == savedIntrStatus)
+    {
+        Cy_SysInt_ProfileRecord(&profileCritical, profileCriticalStart);
+    }
+
+    (Cy_SysLib_ExitCriticalSection)(savedIntrStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileGetIsrStats
+****************************************************************************//**
+*
+* \brief Returns the profiler statistics of the interrupt.
+*
+* \param IRQn
+* Interrupt source
+*
+* \return
+* The statistics entry, or NULL if IRQn is not profiled.
+*
+*******************************************************************************/
+const cy_stc_sysint_profile_t * Cy_SysInt_ProfileGetIsrStats(IRQn_Type IRQn)
+{
+    const cy_stc_sysint_profile_t *stats = NULL;
+
+    if (((int32_t) IRQn >= 0L) && ((uint32_t) IRQn < CY_SYSINT_PROFILE_IRQ_NUM))
+    {
+        stats = &profileIsr[(uint32_t) IRQn];
+    }
+
+    return (stats);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileGetCriticalStats
+****************************************************************************//**
+*
+* \brief Returns the profiler statistics of the critical sections.
+*
+* \return
+* The statistics entry.
+*
+*******************************************************************************/
+const cy_stc_sysint_profile_t * Cy_SysInt_ProfileGetCriticalStats(void)
+{
+    return (&profileCritical);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_ProfileRecord
+****************************************************************************//**
+*
+* Adds the time elapsed since start to the statistics entry.
+*
+*******************************************************************************/
+static void Cy_SysInt_ProfileRecord(cy_stc_sysint_profile_t *stats, uint32_t start)
+{
+    if (NULL != profileCounter)
+    {
+        uint32_t duration = (*profileCounter - start) & TCPWM_CNT_COUNTER_COUNTER_Msk;
+        uint32_t bin = duration >> CY_SYSINT_PROFILE_HIST_SHIFT;
+
+        if (bin >= CY_SYSINT_PROFILE_HIST_BINS)
+        {
+            bin = CY_SYSINT_PROFILE_HIST_BINS - 1UL;
+        }
+
+        if (duration < (uint32_t) stats->min)
+        {
+            stats->min = (uint16_t) duration;
+        }
+
+        if (duration > (uint32_t) stats->max)
+        {
+            stats->max = (uint16_t) duration;
+        }
+
+        if (stats->hist[bin] < 0xFFFFU)
+        {
+            stats->hist[bin]++;
+        }
+
+        stats->count++;
+    }
+}
+#endif /* (CY_SYSINT_PROFILE != 0U) && defined(CY_IP_M0S8TCPWM) */
+
+
 /* [] END OF FILE */
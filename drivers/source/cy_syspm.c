@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_syspm.c
-* \version 1.0
+* \version 1.10
 *
 * This driver provides the source code for API power management.
 *
@@ -22,6 +22,9 @@
 * limitations under the License.
 *******************************************************************************/
 #include "cy_syspm.h"
+#if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+    #include "cy_systick.h"
+#endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
 
 /*******************************************************************************
 *       Internal Defines
@@ -30,6 +33,60 @@
 /* The define for number of callback roots */
 #define CALLBACK_ROOT_NR                (5U)
 
+#if (CY_SYSPM_CALLBACK_TABLE != 0U)
+/* The number of callback types that have the callback table:
+*  CY_SYSPM_SLEEP and CY_SYSPM_DEEPSLEEP
+*/
+#define CALLBACK_TABLE_NR               (2U)
+
+/* The number of callback modes */
+#define CALLBACK_MODE_NR                (4U)
+
+/* The callback table of one callback type */
+typedef struct
+{
+    /* The callbacks executed in each mode, in the registration order */
+    cy_stc_syspm_callback_t *callback[CALLBACK_MODE_NR][CY_SYSPM_CALLBACK_TABLE_SIZE];
+
+    /* The number of callbacks executed in each mode */
+    uint8_t num[CALLBACK_MODE_NR];
+
+    /* The number of the CY_SYSPM_CHECK_FAIL callbacks registered before
+    *  each CY_SYSPM_CHECK_READY callback
+    */
+    uint8_t checkFailNum[CY_SYSPM_CALLBACK_TABLE_SIZE];
+
+    /* The number of CY_SYSPM_CHECK_READY callbacks executed last time */
+    uint8_t checkReadyNum;
+
+    /* The table holds all registered callbacks */
+    bool valid;
+
+#if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+    /* The last measured execution time of each callback, in CPU cycles */
+    uint32_t cycles[CALLBACK_MODE_NR][CY_SYSPM_CALLBACK_TABLE_SIZE];
+#endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
+} cy_stc_syspm_callback_table_t;
+#endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
+
+
+/*******************************************************************************
+*       Internal Functions
+*******************************************************************************/
+
+#if (CY_SYSPM_CALLBACK_TABLE != 0U)
+static uint32_t GetModeIdx(cy_en_syspm_callback_mode_t mode);
+static void UpdateCallbackTable(uint32_t type);
+static cy_en_syspm_status_t ExecuteCallbackTable(uint32_t type, cy_en_syspm_callback_mode_t mode);
+static cy_en_syspm_status_t RunCallback(cy_stc_syspm_callback_t *callback, cy_en_syspm_callback_mode_t mode, uint32_t *cycles);
+#endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
+static cy_en_syspm_status_t ExecuteCallbackList(uint32_t type, cy_en_syspm_callback_mode_t mode);
+static bool HasCallbacks(uint32_t type);
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+static cy_en_syspm_status_t ExecuteStaticCallbacks(uint32_t type, cy_en_syspm_callback_mode_t mode, cy_en_syspm_status_t status);
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+
+
 /*******************************************************************************
 *       Internal Variables
 *******************************************************************************/
@@ -40,6 +97,38 @@ static cy_stc_syspm_callback_t* pmCallbackRoot[CALLBACK_ROOT_NR] = {NULL, NULL,
 /* The array of the pointers to failed callback */
 static cy_stc_syspm_callback_t* failedCallback[CALLBACK_ROOT_NR] = {NULL, NULL, NULL, NULL, NULL};
 
+#if (CY_SYSPM_CALLBACK_TABLE != 0U)
+/* The callback tables of the CY_SYSPM_SLEEP and CY_SYSPM_DEEPSLEEP types */
+static cy_stc_syspm_callback_table_t pmCallbackTable[CALLBACK_TABLE_NR];
+#endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
+
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+/* The static callback table boundaries defined by the linker script */
+#if defined (__ARMCC_VERSION)
+    extern const cy_stc_syspm_static_callback_t Image$$CY_SYSPM_CALLBACKS$$Base[];
+    extern const cy_stc_syspm_static_callback_t Image$$CY_SYSPM_CALLBACKS$$Limit[];
+
+    #define STATIC_CALLBACKS_START      ((const cy_stc_syspm_static_callback_t *) Image$$CY_SYSPM_CALLBACKS$$Base)
+    #define STATIC_CALLBACKS_END        ((const cy_stc_syspm_static_callback_t *) Image$$CY_SYSPM_CALLBACKS$$Limit)
+#elif defined (__GNUC__)
+    extern const cy_stc_syspm_static_callback_t __cy_syspm_callbacks_start__[];
+    extern const cy_stc_syspm_static_callback_t __cy_syspm_callbacks_end__[];
+
+    #define STATIC_CALLBACKS_START      ((const cy_stc_syspm_static_callback_t *) __cy_syspm_callbacks_start__)
+    #define STATIC_CALLBACKS_END        ((const cy_stc_syspm_static_callback_t *) __cy_syspm_callbacks_end__)
+#elif defined (__ICCARM__)
+    #pragma section = "CY_SYSPM_CALLBACKS"
+
+    #define STATIC_CALLBACKS_START      ((const cy_stc_syspm_static_callback_t *) __section_begin("CY_SYSPM_CALLBACKS"))
+    #define STATIC_CALLBACKS_END        ((const cy_stc_syspm_static_callback_t *) __section_end("CY_SYSPM_CALLBACKS"))
+#else
+    #error "An unsupported toolchain"
+#endif  /* (__ARMCC_VERSION) */
+
+/* The static callbacks that failed in the CY_SYSPM_CHECK_READY mode */
+static cy_stc_syspm_static_callback_t const * failedStaticCallback[CALLBACK_ROOT_NR] = {NULL, NULL, NULL, NULL, NULL};
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+
 
 /*******************************************************************************
 * Function Name: Cy_SysPm_CpuEnterSleep
@@ -134,7 +223,7 @@ cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor)
     CY_ASSERT_L3(CY_SYSPM_IS_WAIT_FOR_VALID(waitFor));
 
     /* Call registered callback functions with CY_SYSPM_CHECK_READY parameter */
-    if (pmCallbackRoot[cbSleepRootIdx] != NULL)
+    if (HasCallbacks(cbSleepRootIdx))
     {
         retVal = Cy_SysPm_ExecuteCallback(CY_SYSPM_SLEEP, CY_SYSPM_CHECK_READY);
     }
@@ -149,7 +238,7 @@ cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor)
         * CY_SYSPM_BEFORE_TRANSITION parameter
         */
         interruptState = Cy_SysLib_EnterCriticalSection();
-        if (pmCallbackRoot[cbSleepRootIdx] != NULL)
+        if (HasCallbacks(cbSleepRootIdx))
         {
             (void) Cy_SysPm_ExecuteCallback(CY_SYSPM_SLEEP, CY_SYSPM_BEFORE_TRANSITION);
         }
@@ -186,7 +275,7 @@ cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor)
         /* Call the registered callback functions with the 
         *  CY_SYSPM_AFTER_TRANSITION parameter
         */
-        if (pmCallbackRoot[cbSleepRootIdx] != NULL)
+        if (HasCallbacks(cbSleepRootIdx))
         {
             (void) Cy_SysPm_ExecuteCallback(CY_SYSPM_SLEEP, CY_SYSPM_AFTER_TRANSITION);
         }
@@ -267,7 +356,7 @@ cy_en_syspm_status_t Cy_SysPm_SystemEnterDeepSleep(cy_en_syspm_waitfor_t waitFor
     /* Call the registered callback functions with the CY_SYSPM_CHECK_READY 
     *  parameter
     */
-    if (pmCallbackRoot[cbDeepSleepRootIdx] != NULL)
+    if (HasCallbacks(cbDeepSleepRootIdx))
     {
         retVal = Cy_SysPm_ExecuteCallback(CY_SYSPM_DEEPSLEEP, CY_SYSPM_CHECK_READY);
     }
@@ -285,7 +374,7 @@ cy_en_syspm_status_t Cy_SysPm_SystemEnterDeepSleep(cy_en_syspm_waitfor_t waitFor
         * CY_SYSPM_BEFORE_TRANSITION parameter
         */
         interruptState = Cy_SysLib_EnterCriticalSection();
-        if (pmCallbackRoot[cbDeepSleepRootIdx] != NULL)
+        if (HasCallbacks(cbDeepSleepRootIdx))
         {
             (void) Cy_SysPm_ExecuteCallback(CY_SYSPM_DEEPSLEEP, CY_SYSPM_BEFORE_TRANSITION);
         }
@@ -313,7 +402,7 @@ cy_en_syspm_status_t Cy_SysPm_SystemEnterDeepSleep(cy_en_syspm_waitfor_t waitFor
         /* Call the registered callback functions with the CY_SYSPM_AFTER_TRANSITION 
         *  parameter
         */
-        if (pmCallbackRoot[cbDeepSleepRootIdx] != NULL)
+        if (HasCallbacks(cbDeepSleepRootIdx))
         {
             (void) Cy_SysPm_ExecuteCallback(CY_SYSPM_DEEPSLEEP, CY_SYSPM_AFTER_TRANSITION);
         }  
@@ -324,7 +413,7 @@ cy_en_syspm_status_t Cy_SysPm_SystemEnterDeepSleep(cy_en_syspm_waitfor_t waitFor
         *  undo everything done in the callback with the CY_SYSPM_CHECK_READY 
         *  parameter
         */
-        if (pmCallbackRoot[cbDeepSleepRootIdx] != NULL)
+        if (HasCallbacks(cbDeepSleepRootIdx))
         {
             (void) Cy_SysPm_ExecuteCallback(CY_SYSPM_DEEPSLEEP, CY_SYSPM_CHECK_FAIL);
         }
@@ -489,6 +578,13 @@ bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t* handler)
             handler->prevItm = NULL;
             retVal = true;
         }
+
+    #if (CY_SYSPM_CALLBACK_TABLE != 0U)
+        if (retVal)
+        {
+            UpdateCallbackTable(callbackRootIdx);
+        }
+    #endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
     }
     return retVal;
 }
@@ -564,6 +660,10 @@ bool Cy_SysPm_UnregisterCallback(cy_stc_syspm_callback_t const *handler)
                     curCallback->nextItm->prevItm = curCallback->prevItm;
                 }
             }
+
+        #if (CY_SYSPM_CALLBACK_TABLE != 0U)
+            UpdateCallbackTable(callbackRootIdx);
+        #endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
         }
     }
 
@@ -613,10 +713,88 @@ cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type,
 {
     CY_ASSERT_L3(CY_SYSPM_IS_CALLBACK_TYPE_VALID(type));
     CY_ASSERT_L3(CY_SYSPM_IS_CALLBACK_MODE_VALID(mode));
-    
+
+    cy_en_syspm_status_t retVal = CY_SYSPM_SUCCESS;
+    uint32_t typeIdx = (uint32_t) type;
+    bool execRegistered = (pmCallbackRoot[typeIdx] != NULL);
+
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+    /* The static callbacks are executed before the registered ones
+    *  while entering the low power mode
+    */
+    if ((mode == CY_SYSPM_BEFORE_TRANSITION) || (mode == CY_SYSPM_CHECK_READY))
+    {
+        retVal = ExecuteStaticCallbacks(typeIdx, mode, retVal);
+    }
+
+    if (mode == CY_SYSPM_CHECK_READY)
+    {
+        /* The registered callbacks are not executed after the static callback failed */
+        execRegistered = execRegistered && (retVal != CY_SYSPM_FAIL);
+    }
+    else if (mode == CY_SYSPM_CHECK_FAIL)
+    {
+        /* No registered callbacks were executed if the static callback failed */
+        execRegistered = execRegistered && (failedStaticCallback[typeIdx] == NULL);
+    }
+    else
+    {
+        /* The registered callbacks are executed in all other cases */
+    }
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+
+    if (execRegistered)
+    {
+    #if (CY_SYSPM_CALLBACK_TABLE != 0U)
+        if ((typeIdx < CALLBACK_TABLE_NR) && pmCallbackTable[typeIdx].valid)
+        {
+            retVal = ExecuteCallbackTable(typeIdx, mode);
+        }
+        else
+    #endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
+        {
+            retVal = ExecuteCallbackList(typeIdx, mode);
+        }
+    }
+
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+    /* The static callbacks are executed after the registered ones
+    *  while exiting the low power mode
+    */
+    if ((mode == CY_SYSPM_AFTER_TRANSITION) || (mode == CY_SYSPM_CHECK_FAIL))
+    {
+        retVal = ExecuteStaticCallbacks(typeIdx, mode, retVal);
+    }
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+
+    return retVal;
+}
+
+
+/** \cond INTERNAL */
+/*******************************************************************************
+* Function Name: ExecuteCallbackList
+****************************************************************************//**
+*
+* Executes the registered callbacks of the given type and mode by walking the
+* callback list. Used when the callback table of the type does not hold all
+* the registered callbacks. See \ref Cy_SysPm_ExecuteCallback.
+*
+* \param type
+* The callback type.
+*
+* \param mode
+* The callback mode.
+*
+* \return
+* See \ref Cy_SysPm_ExecuteCallback.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t ExecuteCallbackList(uint32_t type, cy_en_syspm_callback_mode_t mode)
+{
     static cy_stc_syspm_callback_t* lastExecutedCallback = NULL;
     cy_en_syspm_status_t retVal = CY_SYSPM_SUCCESS;
-    cy_stc_syspm_callback_t* curCallback = pmCallbackRoot[(uint32_t) type];
+    cy_stc_syspm_callback_t* curCallback = pmCallbackRoot[type];
     cy_stc_syspm_callback_params_t curParams;
     
     if ((mode == CY_SYSPM_BEFORE_TRANSITION) || (mode == CY_SYSPM_CHECK_READY))
@@ -656,11 +834,11 @@ cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type,
             */
             if(retVal == CY_SYSPM_FAIL)
             {
-                failedCallback[(uint32_t) type] = lastExecutedCallback;
+                failedCallback[type] = lastExecutedCallback;
             }
             else
             {
-                failedCallback[(uint32_t) type] = NULL;
+                failedCallback[type] = NULL;
             }
         }
     }
@@ -712,6 +890,381 @@ cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type,
 }
 
 
+#if (CY_SYSPM_CALLBACK_TABLE != 0U)
+/*******************************************************************************
+* Function Name: ExecuteCallbackTable
+****************************************************************************//**
+*
+* Executes the callbacks of the given type and mode from the callback table.
+* The execution order and the CY_SYSPM_CHECK_FAIL handling are the same as
+* \ref Cy_SysPm_ExecuteCallback describes.
+*
+* \param type
+* The callback type, must have the valid callback table.
+*
+* \param mode
+* The callback mode.
+*
+* \return
+* See \ref Cy_SysPm_ExecuteCallback.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t ExecuteCallbackTable(uint32_t type, cy_en_syspm_callback_mode_t mode)
+{
+    cy_en_syspm_status_t retVal = CY_SYSPM_SUCCESS;
+    cy_stc_syspm_callback_table_t *table = &pmCallbackTable[type];
+    uint32_t modeIdx = GetModeIdx(mode);
+    uint32_t callbackNum = (uint32_t) table->num[modeIdx];
+    uint32_t *cycles = NULL;
+    uint32_t idx;
+
+    if ((mode == CY_SYSPM_BEFORE_TRANSITION) || (mode == CY_SYSPM_CHECK_READY))
+    {
+        /* Execute callbacks from the first to the last registered. Stop
+        *  executing if CY_SYSPM_FAIL was returned in CY_SYSPM_CHECK_READY mode.
+        */
+        for (idx = 0UL; (idx < callbackNum) && ((retVal != CY_SYSPM_FAIL) || (mode != CY_SYSPM_CHECK_READY)); idx++)
+        {
+        #if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+            cycles = &table->cycles[modeIdx][idx];
+        #endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
+
+            retVal = RunCallback(table->callback[modeIdx][idx], mode, cycles);
+        }
+
+        if (mode == CY_SYSPM_CHECK_READY)
+        {
+            /* Store the number of executed callbacks to undo them in the
+            *  CY_SYSPM_CHECK_FAIL mode. The callback that failed is the last one.
+            */
+            table->checkReadyNum = (uint8_t) idx;
+
+            failedCallback[type] = (retVal == CY_SYSPM_FAIL) ? table->callback[modeIdx][idx - 1UL] : NULL;
+        }
+    }
+    else
+    {
+        /* Execute callbacks from the last to the first registered. In the
+        *  CY_SYSPM_CHECK_FAIL mode, start from the callback registered before
+        *  the callback that returned CY_SYSPM_FAIL.
+        */
+        if (mode == CY_SYSPM_CHECK_FAIL)
+        {
+            callbackNum = (0U != table->checkReadyNum) ?
+                          (uint32_t) table->checkFailNum[table->checkReadyNum - 1U] : 0UL;
+        }
+
+        for (idx = callbackNum; idx > 0UL; idx--)
+        {
+        #if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+            cycles = &table->cycles[modeIdx][idx - 1UL];
+        #endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
+
+            retVal = RunCallback(table->callback[modeIdx][idx - 1UL], mode, cycles);
+        }
+    }
+
+    return retVal;
+}
+
+
+/*******************************************************************************
+* Function Name: RunCallback
+****************************************************************************//**
+*
+* Executes one callback with the given mode.
+*
+* \param callback
+* The callback to execute.
+*
+* \param mode
+* The callback mode.
+*
+* \param cycles
+* The pointer to store the callback execution time in CPU cycles.
+* The time is measured only if the SysTick timer runs from the CPU clock
+* and the callback execution does not exceed the SysTick period, otherwise
+* 0 is stored. NULL - the time is not measured.
+*
+* \return
+* The callback return value.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t RunCallback(cy_stc_syspm_callback_t *callback, cy_en_syspm_callback_mode_t mode, uint32_t *cycles)
+{
+    cy_en_syspm_status_t retVal;
+    cy_stc_syspm_callback_params_t curParams;
+
+    /* Update elements for local callback parameter values */
+    curParams.base = callback->callbackParams->base;
+    curParams.context = callback->callbackParams->context;
+
+#if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+    if (NULL != cycles)
+    {
+        bool measure = (_FLD2BOOL(SysTick_CTRL_ENABLE, SYSTICK_CTRL) &&
+                        (CY_SYSTICK_CLOCK_SOURCE_CLK_CPU == Cy_SysTick_GetClockSource()));
+        uint32_t startTick = Cy_SysTick_GetValue();
+
+        retVal = callback->callback(&curParams, mode);
+
+        if (measure)
+        {
+            uint32_t endTick = Cy_SysTick_GetValue();
+
+            /* SysTick counts down and is reloaded after 0 */
+            *cycles = (startTick >= endTick) ? (startTick - endTick) :
+                                               (startTick + ((Cy_SysTick_GetReload() + 1UL) - endTick));
+        }
+        else
+        {
+            *cycles = 0UL;
+        }
+    }
+    else
+#else
+    (void) cycles;
+#endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
+    {
+        retVal = callback->callback(&curParams, mode);
+    }
+
+    return retVal;
+}
+
+
+/*******************************************************************************
+* Function Name: UpdateCallbackTable
+****************************************************************************//**
+*
+* Rebuilds the callback table of the given type from the callback list.
+* For each mode, the table holds the callbacks that do not skip this mode,
+* in the list order. If a mode has more callbacks than the table holds,
+* the table is marked invalid and the callback list is used instead.
+*
+* \param type
+* The callback type. The types without the callback table are ignored.
+*
+*******************************************************************************/
+static void UpdateCallbackTable(uint32_t type)
+{
+    if (type < CALLBACK_TABLE_NR)
+    {
+        cy_stc_syspm_callback_table_t *table = &pmCallbackTable[type];
+        cy_stc_syspm_callback_t *curCallback = pmCallbackRoot[type];
+        uint32_t modeIdx;
+
+        table->valid = false;
+        table->checkReadyNum = 0U;
+
+        for (modeIdx = 0UL; modeIdx < CALLBACK_MODE_NR; modeIdx++)
+        {
+            table->num[modeIdx] = 0U;
+        }
+
+        while (curCallback != NULL)
+        {
+            for (modeIdx = 0UL; modeIdx < CALLBACK_MODE_NR; modeIdx++)
+            {
+                /* The mode index matches the bit of the mode in the .skipMode element */
+                if (0UL == ((1UL << modeIdx) & curCallback->skipMode))
+                {
+                    uint32_t num = (uint32_t) table->num[modeIdx];
+
+                    if (num < CY_SYSPM_CALLBACK_TABLE_SIZE)
+                    {
+                        if (modeIdx == GetModeIdx(CY_SYSPM_CHECK_READY))
+                        {
+                            table->checkFailNum[num] = table->num[GetModeIdx(CY_SYSPM_CHECK_FAIL)];
+                        }
+
+                        table->callback[modeIdx][num] = curCallback;
+                    #if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+                        table->cycles[modeIdx][num] = 0UL;
+                    #endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
+                    }
+
+                    /* Saturate to detect the table overflow */
+                    table->num[modeIdx] = (uint8_t) ((num < 0xFFUL) ? (num + 1UL) : num);
+                }
+            }
+
+            curCallback = curCallback->nextItm;
+        }
+
+        table->valid = true;
+
+        for (modeIdx = 0UL; modeIdx < CALLBACK_MODE_NR; modeIdx++)
+        {
+            if ((uint32_t) table->num[modeIdx] > CY_SYSPM_CALLBACK_TABLE_SIZE)
+            {
+                table->valid = false;
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: GetModeIdx
+****************************************************************************//**
+*
+* Returns the callback table index of the callback mode.
+*
+* \param mode
+* The callback mode.
+*
+* \return
+* The index: 0 - CY_SYSPM_CHECK_READY, 1 - CY_SYSPM_CHECK_FAIL,
+* 2 - CY_SYSPM_BEFORE_TRANSITION, 3 - CY_SYSPM_AFTER_TRANSITION.
+*
+*******************************************************************************/
+static uint32_t GetModeIdx(cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t modeIdx;
+
+    switch (mode)
+    {
+        case CY_SYSPM_CHECK_READY:
+            modeIdx = 0UL;
+        break;
+
+        case CY_SYSPM_CHECK_FAIL:
+            modeIdx = 1UL;
+        break;
+
+        case CY_SYSPM_BEFORE_TRANSITION:
+            modeIdx = 2UL;
+        break;
+
+        default: /* CY_SYSPM_AFTER_TRANSITION */
+            modeIdx = 3UL;
+        break;
+    }
+
+    return modeIdx;
+}
+#endif /* (CY_SYSPM_CALLBACK_TABLE != 0U) */
+
+/*******************************************************************************
+* Function Name: HasCallbacks
+****************************************************************************//**
+*
+* Checks whether any callback of the given type can be executed.
+*
+* \param type
+* The callback type.
+*
+* \return
+* True if callbacks of this type are registered or the static callbacks
+* are enabled and declared.
+*
+*******************************************************************************/
+static bool HasCallbacks(uint32_t type)
+{
+    bool retVal = (pmCallbackRoot[type] != NULL);
+
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+    retVal = retVal || (STATIC_CALLBACKS_START != STATIC_CALLBACKS_END);
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+
+    return retVal;
+}
+
+
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+/*******************************************************************************
+* Function Name: ExecuteStaticCallbacks
+****************************************************************************//**
+*
+* Executes the static callbacks of the given type and mode from the table
+* collected by the linker. The execution order and the CY_SYSPM_CHECK_FAIL
+* handling are the same as \ref Cy_SysPm_ExecuteCallback describes.
+*
+* \param type
+* The callback type.
+*
+* \param mode
+* The callback mode.
+*
+* \param status
+* The status to return if no static callback is executed.
+*
+* \return
+* The return value of the last executed callback or status.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t ExecuteStaticCallbacks(uint32_t type, cy_en_syspm_callback_mode_t mode, cy_en_syspm_status_t status)
+{
+    cy_en_syspm_status_t retVal = status;
+    cy_stc_syspm_static_callback_t const *curCallback;
+    cy_stc_syspm_callback_params_t curParams;
+
+    if ((mode == CY_SYSPM_BEFORE_TRANSITION) || (mode == CY_SYSPM_CHECK_READY))
+    {
+        /* Execute callbacks in the table order. Stop executing if CY_SYSPM_FAIL
+        *  was returned in CY_SYSPM_CHECK_READY mode.
+        */
+        for (curCallback = STATIC_CALLBACKS_START;
+             (curCallback < STATIC_CALLBACKS_END) && ((retVal != CY_SYSPM_FAIL) || (mode != CY_SYSPM_CHECK_READY));
+             curCallback++)
+        {
+            if (((uint32_t) curCallback->type == type) && (0UL == ((uint32_t) mode & curCallback->skipMode)))
+            {
+                /* Update elements for local callback parameter values */
+                curParams.base = curCallback->callbackParams->base;
+                curParams.context = curCallback->callbackParams->context;
+
+                retVal = curCallback->callback(&curParams, mode);
+            }
+        }
+
+        if (mode == CY_SYSPM_CHECK_READY)
+        {
+            /* The failed callback is the last executed one */
+            failedStaticCallback[type] = (retVal == CY_SYSPM_FAIL) ? (curCallback - 1) : NULL;
+
+            if (retVal == CY_SYSPM_FAIL)
+            {
+                /* No registered callback is executed, so none of them failed */
+                failedCallback[type] = NULL;
+            }
+        }
+    }
+    else
+    {
+        /* Execute callbacks in the reverse table order. In the
+        *  CY_SYSPM_CHECK_FAIL mode, start from the callback before the
+        *  failed one, or from the last one if a registered callback failed.
+        */
+        curCallback = STATIC_CALLBACKS_END;
+
+        if ((mode == CY_SYSPM_CHECK_FAIL) && (failedStaticCallback[type] != NULL))
+        {
+            curCallback = failedStaticCallback[type];
+        }
+
+        while (curCallback > STATIC_CALLBACKS_START)
+        {
+            curCallback--;
+
+            if (((uint32_t) curCallback->type == type) && (0UL == ((uint32_t) mode & curCallback->skipMode)))
+            {
+                /* Update elements for local callback parameter values */
+                curParams.base = curCallback->callbackParams->base;
+                curParams.context = curCallback->callbackParams->context;
+
+                retVal = curCallback->callback(&curParams, mode);
+            }
+        }
+    }
+
+    return retVal;
+}
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+/** \endcond */
+
+
 /*******************************************************************************
 * Function Name: Cy_SysPm_GetFailedCallback
 ****************************************************************************//**
@@ -742,4 +1295,83 @@ cy_stc_syspm_callback_t* Cy_SysPm_GetFailedCallback(cy_en_syspm_callback_type_t
     return failedCallback[(uint32_t) type];
 }
 
+
+#if (CY_SYSPM_STATIC_CALLBACKS != 0U)
+/*******************************************************************************
+* Function Name: Cy_SysPm_GetFailedStaticCallback
+****************************************************************************//**
+*
+* Reads the static callback that failed in the CY_SYSPM_CHECK_READY mode
+* during the last power mode transition of the given type.
+*
+* \param type
+* Power mode for which a callback execution result is required.
+*
+* \return
+* - The address of the static callback structure if the callback handler
+* function failed.
+* - NULL if all static callbacks skipped or executed successfully.
+*
+*******************************************************************************/
+cy_stc_syspm_static_callback_t const * Cy_SysPm_GetFailedStaticCallback(cy_en_syspm_callback_type_t type)
+{
+    return failedStaticCallback[(uint32_t) type];
+}
+#endif /* (CY_SYSPM_STATIC_CALLBACKS != 0U) */
+
+
+#if (CY_SYSPM_CALLBACK_PROFILING != 0U)
+/*******************************************************************************
+* Function Name: Cy_SysPm_GetCallbackCycles
+****************************************************************************//**
+*
+* Returns the execution time of the callback measured during its last
+* execution in the given mode.
+*
+* The time is measured by the SysTick timer, so it is available only when the
+* SysTick timer is enabled and runs from the CPU clock. Only the callbacks of
+* the CY_SYSPM_SLEEP and CY_SYSPM_DEEPSLEEP types executed from the callback
+* table are measured, see \ref group_syspm_callback_table. The measurement is
+* reset when a callback of the same type is registered or unregistered.
+*
+* \param handler
+* The registered callback. See \ref cy_stc_syspm_callback_t.
+*
+* \param mode
+* The callback mode. See \ref cy_en_syspm_callback_mode_t.
+*
+* \return
+* The callback execution time in CPU cycles, including the call overhead.
+* 0 if the callback was not executed or measured in this mode.
+*
+*******************************************************************************/
+uint32_t Cy_SysPm_GetCallbackCycles(cy_stc_syspm_callback_t const *handler, cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t retVal = 0UL;
+
+    CY_ASSERT_L3(CY_SYSPM_IS_CALLBACK_MODE_VALID(mode));
+
+    if ((handler != NULL) && ((uint32_t) handler->type < CALLBACK_TABLE_NR))
+    {
+        cy_stc_syspm_callback_table_t const *table = &pmCallbackTable[(uint32_t) handler->type];
+        uint32_t modeIdx = GetModeIdx(mode);
+        uint32_t idx;
+
+        if (table->valid)
+        {
+            for (idx = 0UL; idx < (uint32_t) table->num[modeIdx]; idx++)
+            {
+                if (table->callback[modeIdx][idx] == handler)
+                {
+                    retVal = table->cycles[modeIdx][idx];
+                    break;
+                }
+            }
+        }
+    }
+
+    return retVal;
+}
+#endif /* (CY_SYSPM_CALLBACK_PROFILING != 0U) */
+
 /* [] END OF FILE */
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_systick.c
-* \version 1.0
+* \version 1.10
 *
 * Provides the API definitions of the SisTick driver.
 *
@@ -23,11 +23,78 @@
 *******************************************************************************/
 
 #include "cy_systick.h"
+#include "cy_sysclk.h"
+#include "cy_wdt.h"
 #include <stddef.h>     /* for NULL */
 
 
+/* The number of the microseconds in a second */
+#define CY_SYSTICK_US_PER_SEC           (1000000UL)
+
+/* The longest delay of a single Cy_SysLib_DelayUs() call */
+#define CY_SYSTICK_DELAY_US_MAX         (0xFFFFUL)
+
+/* The exception numbers in IPSR */
+#define CY_SYSTICK_SVCALL_EXC_NUM       (11UL)
+#define CY_SYSTICK_PENDSV_EXC_NUM       (14UL)
+#define CY_SYSTICK_IRQ0_EXC_NUM         (16UL)
+
+/* The WDT register changes take up to three ILO cycles to come into effect */
+#define CY_SYSTICK_TICKLESS_MIN_ILO     (4UL)
+
+/* The longest Deep Sleep within the 16-bit WDT counter range */
+#define CY_SYSTICK_TICKLESS_MAX_ILO     (WDT_MAX_MATCH_VALUE - CY_SYSTICK_TICKLESS_MIN_ILO)
+
+/* The shortest rest of a tick the SysTick counter is reloaded with after Deep
+* Sleep. A shorter rest completes the tick, as the reload value must be
+* restored before the counter reaches zero.
+*/
+#define CY_SYSTICK_TICKLESS_MIN_LOAD    (64UL)
+
+/* The tickless SysPm callback runs last before and first after Deep Sleep */
+#define CY_SYSTICK_TICKLESS_PM_ORDER    (255U)
+
+#if (CY_SYSTICK_TIMER_WHEEL != 0U)
+/* The number of the slots per timer wheel level */
+#define CY_SYSTICK_TIMER_WHEEL_SLOTS    (1UL << CY_SYSTICK_TIMER_WHEEL_BITS)
+
+/* The timer wheel slot index mask */
+#define CY_SYSTICK_TIMER_WHEEL_MASK     (CY_SYSTICK_TIMER_WHEEL_SLOTS - 1UL)
+
+/* The maximum delay the timer wheel can hold, longer delays are cascaded again */
+#define CY_SYSTICK_TIMER_WHEEL_MAX      ((1UL << (CY_SYSTICK_TIMER_WHEEL_BITS * CY_SYSTICK_TIMER_WHEEL_LEVELS)) - 1UL)
+
+static cy_stc_systick_timer_t *Cy_SysTick_TimerWheel[CY_SYSTICK_TIMER_WHEEL_LEVELS][CY_SYSTICK_TIMER_WHEEL_SLOTS];
+static void Cy_SysTick_TimerLink(cy_stc_systick_timer_t *timer);
+static void Cy_SysTick_TimerUnlink(cy_stc_systick_timer_t *timer);
+static void Cy_SysTick_ServiceTimers(void);
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) */
+
 static Cy_SysTick_Callback Cy_SysTick_Callbacks[CY_SYS_SYST_NUM_OF_CALLBACKS];
+static volatile uint64_t Cy_SysTick_TickCount;
+static volatile uint32_t Cy_SysTick_LateTicks;
+static volatile bool Cy_SysTick_TicklessArmed;
+static volatile bool Cy_SysTick_TicklessStopped;
+static uint32_t Cy_SysTick_TicklessStart;
+static uint32_t Cy_SysTick_TicklessIloFreq;
 static void Cy_SysTick_ServiceCallbacks(void);
+static cy_en_syspm_status_t Cy_SysTick_TicklessPm(cy_stc_syspm_callback_params_t *callbackParams,
+                                                  cy_en_syspm_callback_mode_t mode);
+static void Cy_SysTick_TicklessResume(void);
+static uint32_t Cy_SysTick_GetClockFreq(void);
+static uint64_t Cy_SysTick_UsToCycles(uint32_t microseconds);
+
+static cy_stc_syspm_callback_params_t Cy_SysTick_TicklessPmParams = {NULL, NULL};
+static cy_stc_syspm_callback_t Cy_SysTick_TicklessPmCallback =
+{
+    &Cy_SysTick_TicklessPm,
+    CY_SYSPM_DEEPSLEEP,
+    CY_SYSPM_SKIP_CHECK_READY | CY_SYSPM_SKIP_CHECK_FAIL,
+    &Cy_SysTick_TicklessPmParams,
+    NULL,
+    NULL,
+    CY_SYSTICK_TICKLESS_PM_ORDER
+};
 
 
 /*******************************************************************************
@@ -36,6 +103,7 @@ static void Cy_SysTick_ServiceCallbacks(void);
 *
 * Initializes the SysTick driver:
 * - Initializes the callback addresses with pointers to NULL
+* - Clears the tick count and stops all the software timers
 * - Associates the SysTick system vector with the callback functions
 * - Sets the SysTick clock by calling \ref Cy_SysTick_SetClockSource()
 * - Sets the SysTick reload interval by calling \ref Cy_SysTick_SetReload()
@@ -59,6 +127,18 @@ void Cy_SysTick_Init(cy_en_systick_clock_source_t clockSource, uint32_t interval
         Cy_SysTick_Callbacks[i] = NULL;
     }
 
+#if (CY_SYSTICK_TIMER_WHEEL != 0U)
+    for (i = 0u; i < (CY_SYSTICK_TIMER_WHEEL_LEVELS * CY_SYSTICK_TIMER_WHEEL_SLOTS); i++)
+    {
+        Cy_SysTick_TimerWheel[i / CY_SYSTICK_TIMER_WHEEL_SLOTS][i & CY_SYSTICK_TIMER_WHEEL_MASK] = NULL;
+    }
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) */
+
+    Cy_SysTick_TickCount = 0u;
+    Cy_SysTick_LateTicks = 0u;
+    Cy_SysTick_TicklessArmed = false;
+    Cy_SysTick_TicklessStopped = false;
+
     __RAM_VECTOR_TABLE[CY_SYSTICK_IRQ_NUM] = &Cy_SysTick_ServiceCallbacks;
     Cy_SysTick_SetClockSource(clockSource);
 
@@ -209,6 +289,866 @@ Cy_SysTick_Callback Cy_SysTick_GetCallback(uint32_t number)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SysTick_GetTicks
+****************************************************************************//**
+*
+* Gets the number of the SysTick interrupts since \ref Cy_SysTick_Init().
+*
+* \return The 64-bit tick count.
+*
+*******************************************************************************/
+uint64_t Cy_SysTick_GetTicks(void)
+{
+    uint64_t retVal;
+    uint32_t interruptState;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    retVal = Cy_SysTick_TickCount;
+
+    /* Account for the reload whose interrupt is not serviced yet, and for
+    * the ticks slept in Deep Sleep that this interrupt accounts.
+    */
+    if (0u != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+    {
+        retVal += 1u + (uint64_t)Cy_SysTick_LateTicks;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_GetCycles
+****************************************************************************//**
+*
+* Gets the number of the SysTick clock cycles since \ref Cy_SysTick_Init().
+*
+* The tick count is combined with the current SysTick counter value, so the
+* resolution is one SysTick clock cycle. The reload value must not be changed
+* after \ref Cy_SysTick_Init().
+*
+* \return The 64-bit cycle count.
+*
+*******************************************************************************/
+uint64_t Cy_SysTick_GetCycles(void)
+{
+    uint64_t ticks;
+    uint32_t value;
+    uint32_t reload;
+    uint32_t interruptState;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    ticks = Cy_SysTick_TickCount;
+    value = SYSTICK_VAL;
+
+    /* The counter has reloaded but the interrupt is not serviced yet. Read the
+    * counter again as the first value could be taken before the reload.
+    */
+    if (0u != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+    {
+        value = SYSTICK_VAL;
+        ticks += 1u + (uint64_t)Cy_SysTick_LateTicks;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    reload = Cy_SysTick_GetReload();
+
+    return ((ticks * ((uint64_t)reload + 1u)) + (uint64_t)(reload - value));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_GetTimeUs
+****************************************************************************//**
+*
+* Gets the time in microseconds since \ref Cy_SysTick_Init().
+*
+* The cycle count returned by \ref Cy_SysTick_GetCycles() is converted using
+* the SystemCoreClock value for the CPU clock source or \ref CY_SYSTICK_CLK_LF_FREQ
+* for the low frequency clock source.
+*
+* \return The 64-bit time in microseconds.
+*
+* \note The function uses 64-bit division and takes significantly longer than
+* \ref Cy_SysTick_GetCycles().
+*
+*******************************************************************************/
+uint64_t Cy_SysTick_GetTimeUs(void)
+{
+    uint64_t cycles = Cy_SysTick_GetCycles();
+    uint32_t freq = Cy_SysTick_GetClockFreq();
+
+    return (((cycles / freq) * CY_SYSTICK_US_PER_SEC) +
+            (((cycles % freq) * CY_SYSTICK_US_PER_SEC) / freq));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_IsTimeBaseRunning
+****************************************************************************//**
+*
+* Checks whether \ref Cy_SysTick_GetCycles() advances at the call point. This
+* requires the SysTick and its interrupt enabled by \ref Cy_SysTick_Init(), the
+* interrupts not masked by PRIMASK, and, when called from an exception handler,
+* the SysTick priority higher than the priority of that exception.
+*
+* \return True if the SysTick interrupt can be serviced at the call point.
+*
+*******************************************************************************/
+bool Cy_SysTick_IsTimeBaseRunning(void)
+{
+    uint32_t exception = __get_IPSR();
+    bool retVal = ((SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk) ==
+                   (SYSTICK_CTRL & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk))) &&
+                  (&Cy_SysTick_ServiceCallbacks == __RAM_VECTOR_TABLE[CY_SYSTICK_IRQ_NUM]) &&
+                  (0UL == __get_PRIMASK());
+
+    if (retVal && (0UL != exception))
+    {
+        /* NMI and HardFault cannot be preempted. SVCall and PendSV are the
+        * configurable system exceptions below the SysTick, IRQs start at 16.
+        */
+        IRQn_Type irqn = (IRQn_Type)((int32_t)exception - (int32_t)CY_SYSTICK_IRQ0_EXC_NUM);
+
+        retVal = ((CY_SYSTICK_SVCALL_EXC_NUM == exception) || (CY_SYSTICK_PENDSV_EXC_NUM == exception) ||
+                  (exception >= CY_SYSTICK_IRQ0_EXC_NUM)) &&
+                 (NVIC_GetPriority(SysTick_IRQn) < NVIC_GetPriority(irqn));
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimeoutStart
+****************************************************************************//**
+*
+* Starts a timeout that expires after the specified time.
+*
+* \param timeout The timeout structure allocated by the caller.
+*
+* \param microseconds The timeout in microseconds. It is rounded up to the
+* SysTick clock cycles.
+*
+*******************************************************************************/
+void Cy_SysTick_TimeoutStart(cy_stc_systick_timeout_t *timeout, uint32_t microseconds)
+{
+    CY_ASSERT_L1(NULL != timeout);
+
+    timeout->deadline = Cy_SysTick_GetCycles() + Cy_SysTick_UsToCycles(microseconds);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimeoutExpired
+****************************************************************************//**
+*
+* Checks whether the timeout started by \ref Cy_SysTick_TimeoutStart() has
+* expired.
+*
+* \param timeout The timeout structure.
+*
+* \return True if the timeout has expired.
+*
+*******************************************************************************/
+bool Cy_SysTick_TimeoutExpired(const cy_stc_systick_timeout_t *timeout)
+{
+    CY_ASSERT_L1(NULL != timeout);
+
+    return (Cy_SysTick_GetCycles() >= timeout->deadline);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_DelayUs
+****************************************************************************//**
+*
+* Waits for at least the specified time measured by the SysTick.
+*
+* The interrupts serviced during the delay do not extend it. The SysTick must be
+* initialized by \ref Cy_SysTick_Init() with its interrupt enabled, and the
+* SysTick interrupt must be able to preempt the caller. Otherwise, for example
+* when called inside a critical section, the function falls back to
+* \ref Cy_SysLib_DelayUs() and the interrupts extend the delay.
+*
+* \param microseconds The delay in microseconds.
+*
+* \param sleep If true, the CPU enters Sleep while the deadline is more than one
+* SysTick period away, so it is woken up by the SysTick interrupt in time.
+* Otherwise the CPU polls the SysTick for the whole delay.
+*
+*******************************************************************************/
+void Cy_SysTick_DelayUs(uint32_t microseconds, bool sleep)
+{
+    if (Cy_SysTick_IsTimeBaseRunning())
+    {
+        cy_stc_systick_timeout_t timeout;
+        uint64_t period = (uint64_t) Cy_SysTick_GetReload() + 1u;
+        uint64_t now;
+
+        Cy_SysTick_TimeoutStart(&timeout, microseconds);
+
+        now = Cy_SysTick_GetCycles();
+
+        while (now < timeout.deadline)
+        {
+            if (sleep && ((timeout.deadline - now) > period))
+            {
+                /* The next SysTick interrupt comes before the deadline */
+                (void) Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+            }
+
+            now = Cy_SysTick_GetCycles();
+        }
+    }
+    else
+    {
+        /* The cycle count would stall: count the CPU cycles instead */
+        uint32_t remain = microseconds;
+
+        while (remain > 0UL)
+        {
+            uint16_t step = (remain > CY_SYSTICK_DELAY_US_MAX) ? (uint16_t) CY_SYSTICK_DELAY_US_MAX : (uint16_t) remain;
+
+            Cy_SysLib_DelayUs(step);
+            remain -= step;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_UsToCycles
+****************************************************************************//**
+*
+* Converts microseconds to the SysTick clock cycles, rounding up.
+*
+* \param microseconds The time in microseconds.
+*
+* \return The number of the SysTick clock cycles.
+*
+*******************************************************************************/
+static uint64_t Cy_SysTick_UsToCycles(uint32_t microseconds)
+{
+    return ((((uint64_t) microseconds * Cy_SysTick_GetClockFreq()) + (CY_SYSTICK_US_PER_SEC - 1UL)) /
+            CY_SYSTICK_US_PER_SEC);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_GetClockFreq
+****************************************************************************//**
+*
+* Gets the frequency of the SysTick clock source.
+*
+* \return The frequency in Hz.
+*
+*******************************************************************************/
+static uint32_t Cy_SysTick_GetClockFreq(void)
+{
+    return ((CY_SYSTICK_CLOCK_SOURCE_CLK_CPU == Cy_SysTick_GetClockSource()) ?
+                SystemCoreClock : CY_SYSTICK_CLK_LF_FREQ);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TicklessIdle
+****************************************************************************//**
+*
+* Puts the device into the lowest power mode the software timers allow.
+*
+* If the next software timer deadline (limited by maxTicks) is at least
+* \ref CY_SYSTICK_TICKLESS_MIN_TICKS ticks away, the WDT match is set to the
+* deadline and the device enters Deep Sleep. The SysTick keeps running while
+* the SysPm callbacks prepare the transition. It is stopped by an internal
+* CY_SYSPM_DEEPSLEEP callback of order 255, which runs last in the
+* CY_SYSPM_BEFORE_TRANSITION mode, and restarted by the same callback, which
+* runs first in the CY_SYSPM_AFTER_TRANSITION mode. The slept time is measured
+* by the WDT counter and added to the SysTick counter, so the monotonic clock
+* does not lose the part of a tick. The SysTick interrupt then advances the
+* tick count and the timer wheel over the slept ticks in one pass.
+* Otherwise the CPU enters Sleep with the SysTick running.
+*
+* The interrupts are masked only while the idle budget and the WDT wakeup are
+* set up, so the power mode callbacks run with the interrupts enabled. If a
+* timer is started after the budget is computed, the Deep Sleep entry returns
+* at once.
+*
+* \param maxTicks The maximum number of the ticks to stay in Deep Sleep.
+* Pass \ref CY_SYSTICK_IDLE_FOREVER to be limited by the software timers only.
+*
+* \return The status of \ref Cy_SysPm_SystemEnterDeepSleep() or
+* Cy_SysPm_CpuEnterSleep().
+*
+* \note The WDT is shared with the application, see \ref group_systick_tickless.
+* The WDT interrupt is used to wake up the device. It is disabled in the NVIC
+* and wakes up the CPU as an event (SEVONPEND), so the WDT interrupt handler is
+* not called for it.
+*
+*******************************************************************************/
+cy_en_syspm_status_t Cy_SysTick_TicklessIdle(uint32_t maxTicks)
+{
+    cy_en_syspm_status_t retVal;
+    uint32_t interruptState;
+    uint32_t idleTicks = maxTicks;
+    uint32_t iloCycles = 0UL;
+    uint32_t reload = Cy_SysTick_GetReload();
+    uint32_t freq = Cy_SysTick_GetClockFreq();
+    uint32_t value;
+    bool wdtEnabled;
+    bool wdtUnmasked = false;
+    bool sevOnPend = false;
+    uint32_t irqEnabled = 0UL;
+    uint32_t match = 0UL;
+    uint32_t ignoreBits = 0UL;
+    uint32_t start = 0UL;
+    bool deepSleep = false;
+
+    /* Only the idle budget and the WDT wakeup are set up with the interrupts
+    * masked. The power mode callbacks and the timers run with the interrupts
+    * enabled.
+    */
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    wdtEnabled = Cy_WDT_IsEnabled();
+
+#if (CY_SYSTICK_TIMER_WHEEL != 0U)
+    {
+        uint32_t timerTicks = Cy_SysTick_TimerGetIdleTicks();
+
+        if (timerTicks < idleTicks)
+        {
+            idleTicks = timerTicks;
+        }
+    }
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) */
+
+    value = SYSTICK_VAL;
+
+    /* A pending WDT match of the application is left for its handler */
+    if ((CY_SYSTICK_TICKLESS_MIN_TICKS <= idleTicks) &&
+        (0u == (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) &&
+        (!(wdtEnabled && _FLD2BOOL(SRSSLT_SRSS_INTR_WDT_MATCH, SRSSLT_SRSS_INTR))) &&
+        (CY_SYSCLK_SUCCESS == Cy_SysClk_IloCalProcess()))
+    {
+        /* The rest of the current tick and the following idle ticks */
+        uint64_t cycles = ((uint64_t)(idleTicks - 1u) * ((uint64_t)reload + 1u)) + value;
+
+        Cy_SysTick_TicklessIloFreq = Cy_SysClk_IloCalGetFreq();
+        cycles = (cycles * Cy_SysTick_TicklessIloFreq) / freq;
+        iloCycles = (cycles < CY_SYSTICK_TICKLESS_MAX_ILO) ? (uint32_t)cycles : CY_SYSTICK_TICKLESS_MAX_ILO;
+    }
+
+    if (CY_SYSTICK_TICKLESS_MIN_ILO <= iloCycles)
+    {
+        wdtUnmasked = _FLD2BOOL(SRSSLT_SRSS_INTR_MASK_WDT_MATCH, SRSSLT_SRSS_INTR_MASK);
+        irqEnabled = NVIC_GetEnableIRQ(srss_interrupt_wdt_IRQn);
+        match = Cy_WDT_GetMatch();
+        ignoreBits = Cy_WDT_GetIgnoreBits();
+        sevOnPend = (0UL != (SCB->SCR & SCB_SCR_SEVONPEND_Msk));
+
+        if (!wdtEnabled)
+        {
+            /* The application does not use the WDT, so its flag is stale */
+            Cy_WDT_ClearInterrupt();
+            Cy_WDT_Enable();
+        }
+
+        start = Cy_WDT_GetCount();
+        Cy_WDT_SetIgnoreBits(0UL);
+        Cy_WDT_SetMatch((start + iloCycles) & WDT_MAX_MATCH_VALUE);
+        Cy_WDT_UnmaskInterrupt();
+
+        /* The WDT interrupt wakes up WFE as an event while it is disabled in
+        * the NVIC, so no WDT handler runs when the interrupts are unmasked.
+        * The WDT flag is not set, so any NVIC pending state is stale and
+        * would block the event.
+        */
+        NVIC_DisableIRQ(srss_interrupt_wdt_IRQn);
+        NVIC_ClearPendingIRQ(srss_interrupt_wdt_IRQn);
+        SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+        Cy_SysTick_TicklessArmed = true;
+        deepSleep = true;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    if (deepSleep)
+    {
+        uint32_t now;
+        bool appMatch = false;
+
+        /* Does nothing if the callback is already registered */
+        (void) Cy_SysPm_RegisterCallback(&Cy_SysTick_TicklessPmCallback);
+
+        retVal = Cy_SysPm_SystemEnterDeepSleep(CY_SYSPM_WAIT_FOR_EVENT);
+
+        interruptState = Cy_SysLib_EnterCriticalSection();
+
+        Cy_SysTick_TicklessArmed = false;
+
+        /* Restart the SysTick if the callback did not run after the transition */
+        Cy_SysTick_TicklessResume();
+
+        now = Cy_WDT_GetCount();
+
+        /* Clear the tickless match. This also services the watchdog. */
+        Cy_WDT_ClearInterrupt();
+        NVIC_ClearPendingIRQ(srss_interrupt_wdt_IRQn);
+
+        /* Restore the WDT configuration */
+        Cy_WDT_SetIgnoreBits(ignoreBits);
+        if (wdtEnabled)
+        {
+            uint32_t mask = WDT_MAX_MATCH_VALUE >> ignoreBits;
+
+            /* The application match is pended again if the counter passed it */
+            appMatch = (((now - start) & WDT_MAX_MATCH_VALUE) > ((match - start - 1UL) & mask));
+
+            /* The next application match at or after the current count */
+            Cy_WDT_SetMatch((now + ((match - now) & mask)) & WDT_MAX_MATCH_VALUE);
+        }
+        else
+        {
+            Cy_WDT_SetMatch(match);
+            Cy_WDT_Disable();
+        }
+        if (!wdtUnmasked)
+        {
+            Cy_WDT_MaskInterrupt();
+        }
+        if (appMatch)
+        {
+            SRSSLT_SRSS_INTR_SET = SRSSLT_SRSS_INTR_WDT_MATCH_Msk;
+        }
+        if (0UL != irqEnabled)
+        {
+            NVIC_EnableIRQ(srss_interrupt_wdt_IRQn);
+        }
+        if (!sevOnPend)
+        {
+            SCB->SCR &= ~SCB_SCR_SEVONPEND_Msk;
+        }
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+    else
+    {
+        retVal = Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TicklessPm
+****************************************************************************//**
+*
+* The SysPm callback of \ref Cy_SysTick_TicklessIdle(). Stops the SysTick when
+* the Deep Sleep transition is committed and restarts it on wakeup.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t Cy_SysTick_TicklessPm(cy_stc_syspm_callback_params_t *callbackParams,
+                                                  cy_en_syspm_callback_mode_t mode)
+{
+    (void) callbackParams;
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        /* The interrupts are masked until the device enters Deep Sleep */
+        if (Cy_SysTick_TicklessArmed)
+        {
+            Cy_SysTick_TicklessStart = Cy_WDT_GetCount();
+            Cy_SysTick_Disable();
+            Cy_SysTick_TicklessStopped = true;
+        }
+    }
+    else if (CY_SYSPM_AFTER_TRANSITION == mode)
+    {
+        Cy_SysTick_TicklessResume();
+    }
+    else
+    {
+        /* The other modes are skipped */
+    }
+
+    return (CY_SYSPM_SUCCESS);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TicklessResume
+****************************************************************************//**
+*
+* Adds the time measured by the WDT since the SysTick was stopped to the
+* SysTick counter and restarts it. The whole slept ticks are accounted by the
+* SysTick interrupt, the rest is loaded into the counter.
+*
+*******************************************************************************/
+static void Cy_SysTick_TicklessResume(void)
+{
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+    if (Cy_SysTick_TicklessStopped)
+    {
+        uint32_t reload = Cy_SysTick_GetReload();
+        uint64_t cycles = (Cy_WDT_GetCount() - Cy_SysTick_TicklessStart) & WDT_MAX_MATCH_VALUE;
+
+        Cy_SysTick_TicklessStopped = false;
+
+        cycles = (cycles * Cy_SysTick_GetClockFreq()) / Cy_SysTick_TicklessIloFreq;
+
+        if (0u != cycles)
+        {
+            uint64_t period = (uint64_t)reload + 1u;
+            uint32_t ticks;
+            uint32_t load;
+
+            /* Count from the start of the tick the SysTick was stopped in */
+            cycles += (uint64_t)(reload - SYSTICK_VAL);
+            ticks = (uint32_t)(cycles / period);
+            load = reload - (uint32_t)(cycles % period);
+
+            if (load < CY_SYSTICK_TICKLESS_MIN_LOAD)
+            {
+                ticks++;
+                load = reload;
+            }
+
+            if (0u != ticks)
+            {
+                /* A pending interrupt already accounts for one tick */
+                if (0u != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+                {
+                    Cy_SysTick_LateTicks += ticks;
+                }
+                else
+                {
+                    Cy_SysTick_LateTicks += ticks - 1u;
+                    SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+                }
+            }
+
+            /* Run the rest of the tick, then continue with the full ticks */
+            Cy_SysTick_SetReload(load);
+            Cy_SysTick_Clear();
+            Cy_SysTick_Enable();
+
+            while (0u == SYSTICK_VAL)
+            {
+                /* Wait for the counter to load the rest of the tick */
+            }
+
+            Cy_SysTick_SetReload(reload);
+        }
+        else
+        {
+            /* No time was slept, so the counter continues where it stopped */
+            Cy_SysTick_Enable();
+        }
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+
+#if (CY_SYSTICK_TIMER_WHEEL != 0U)
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerInit
+****************************************************************************//**
+*
+* Initializes the software timer structure. The timer is stopped.
+*
+* \param timer The pointer to the timer structure.
+*
+* \param callback The function to be called when the timer expires. It is
+* executed in the SysTick interrupt context.
+*
+* \param arg The argument passed to the callback.
+*
+*******************************************************************************/
+void Cy_SysTick_TimerInit(cy_stc_systick_timer_t *timer, Cy_SysTick_TimerCallback callback, void *arg)
+{
+    CY_ASSERT_L1(NULL != timer);
+    CY_ASSERT_L1(NULL != callback);
+
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->expire = 0u;
+    timer->period = 0u;
+    timer->callback = callback;
+    timer->arg = arg;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerStart
+****************************************************************************//**
+*
+* Starts the software timer. If the timer is running, it is restarted.
+*
+* \param timer The pointer to the timer structure initialized by
+* \ref Cy_SysTick_TimerInit().
+*
+* \param delay The number of the ticks till the first expiration. Zero
+* means the next tick.
+*
+* \param period The number of the ticks between the following expirations.
+* Zero for the one-shot timer.
+*
+* \note The function can be called from the timer callback.
+*
+*******************************************************************************/
+void Cy_SysTick_TimerStart(cy_stc_systick_timer_t *timer, uint32_t delay, uint32_t period)
+{
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != timer);
+    CY_ASSERT_L2(delay <= (uint32_t)INT32_MAX);
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    if (NULL != timer->pprev)
+    {
+        Cy_SysTick_TimerUnlink(timer);
+    }
+
+    timer->expire = (uint32_t)Cy_SysTick_TickCount + ((0u != delay) ? delay : 1u);
+    timer->period = period;
+    Cy_SysTick_TimerLink(timer);
+
+    if (Cy_SysTick_TicklessArmed)
+    {
+        /* The idle budget can be too long for the new timer: make the
+        * Deep Sleep entry in Cy_SysTick_TicklessIdle() return at once.
+        */
+        NVIC_SetPendingIRQ(srss_interrupt_wdt_IRQn);
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerStop
+****************************************************************************//**
+*
+* Stops the software timer. Does nothing if the timer is not running.
+*
+* \param timer The pointer to the timer structure.
+*
+* \note The function can be called from the timer callback.
+*
+*******************************************************************************/
+void Cy_SysTick_TimerStop(cy_stc_systick_timer_t *timer)
+{
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != timer);
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    if (NULL != timer->pprev)
+    {
+        Cy_SysTick_TimerUnlink(timer);
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerGetIdleTicks
+****************************************************************************//**
+*
+* Gets the number of the ticks till the next timer wheel event. It is either
+* the expiration of a timer or the cascade of an upper level slot, which is
+* never later than the expiration of the timers in the slot.
+*
+* \return The number of the ticks, \ref CY_SYSTICK_IDLE_FOREVER if no timer is
+* running.
+*
+*******************************************************************************/
+uint32_t Cy_SysTick_TimerGetIdleTicks(void)
+{
+    uint32_t retVal = CY_SYSTICK_IDLE_FOREVER;
+    uint32_t interruptState;
+    uint32_t now;
+    uint32_t level;
+    uint32_t dist;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    now = (uint32_t)Cy_SysTick_TickCount;
+
+    for (level = 0u; level < CY_SYSTICK_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t shift = level * CY_SYSTICK_TIMER_WHEEL_BITS;
+        uint32_t idx = (now >> shift) & CY_SYSTICK_TIMER_WHEEL_MASK;
+
+        for (dist = 1u; dist <= CY_SYSTICK_TIMER_WHEEL_SLOTS; dist++)
+        {
+            if (NULL != Cy_SysTick_TimerWheel[level][(idx + dist) & CY_SYSTICK_TIMER_WHEEL_MASK])
+            {
+                /* The slot is processed when the lower levels wrap around */
+                uint32_t ticks = (dist << shift) - (now & ((1UL << shift) - 1UL));
+
+                if (ticks < retVal)
+                {
+                    retVal = ticks;
+                }
+                break;
+            }
+        }
+    }
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerLink
+****************************************************************************//**
+*
+* Puts the timer to the timer wheel slot that matches its expiration tick.
+* The timers that expire at the current tick are put to the current slot. The
+* overdue timers are put to the slot of the next tick. The timers beyond the
+* wheel range are put to the farthest slot and cascaded again.
+*
+* \param timer The pointer to the timer structure.
+*
+*******************************************************************************/
+static void Cy_SysTick_TimerLink(cy_stc_systick_timer_t *timer)
+{
+    uint32_t now = (uint32_t)Cy_SysTick_TickCount;
+    uint32_t delta = timer->expire - now;
+    uint32_t expire = timer->expire;
+    uint32_t level = 0u;
+    cy_stc_systick_timer_t **slot;
+
+    if (delta > (uint32_t)INT32_MAX)
+    {
+        delta = 1u;
+        expire = now + 1u;
+    }
+    else if (delta > CY_SYSTICK_TIMER_WHEEL_MAX)
+    {
+        delta = CY_SYSTICK_TIMER_WHEEL_MAX;
+        expire = now + CY_SYSTICK_TIMER_WHEEL_MAX;
+    }
+    else
+    {
+        /* The timer fits the wheel */
+    }
+
+    while (delta >= CY_SYSTICK_TIMER_WHEEL_SLOTS)
+    {
+        delta >>= CY_SYSTICK_TIMER_WHEEL_BITS;
+        level++;
+    }
+
+    slot = &Cy_SysTick_TimerWheel[level][(expire >> (level * CY_SYSTICK_TIMER_WHEEL_BITS)) & CY_SYSTICK_TIMER_WHEEL_MASK];
+
+    timer->next = *slot;
+    if (NULL != timer->next)
+    {
+        timer->next->pprev = &timer->next;
+    }
+    *slot = timer;
+    timer->pprev = slot;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_TimerUnlink
+****************************************************************************//**
+*
+* Removes the timer from its timer wheel slot.
+*
+* \param timer The pointer to the timer structure.
+*
+*******************************************************************************/
+static void Cy_SysTick_TimerUnlink(cy_stc_systick_timer_t *timer)
+{
+    *timer->pprev = timer->next;
+    if (NULL != timer->next)
+    {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysTick_ServiceTimers
+****************************************************************************//**
+*
+* Advances the timer wheel by one tick. The slots of the upper levels are
+* cascaded to the lower levels when the lower level wraps around, then the
+* timers of the current slot of the first level are executed.
+*
+*******************************************************************************/
+static void Cy_SysTick_ServiceTimers(void)
+{
+    uint32_t now = (uint32_t)Cy_SysTick_TickCount;
+    uint32_t level;
+    cy_stc_systick_timer_t **slot;
+    cy_stc_systick_timer_t *timer;
+
+    for (level = 1u; level < CY_SYSTICK_TIMER_WHEEL_LEVELS; level++)
+    {
+        if (0u != ((now >> ((level - 1u) * CY_SYSTICK_TIMER_WHEEL_BITS)) & CY_SYSTICK_TIMER_WHEEL_MASK))
+        {
+            break;
+        }
+
+        slot = &Cy_SysTick_TimerWheel[level][(now >> (level * CY_SYSTICK_TIMER_WHEEL_BITS)) & CY_SYSTICK_TIMER_WHEEL_MASK];
+
+        while (NULL != *slot)
+        {
+            timer = *slot;
+            Cy_SysTick_TimerUnlink(timer);
+            Cy_SysTick_TimerLink(timer);
+        }
+    }
+
+    slot = &Cy_SysTick_TimerWheel[0u][now & CY_SYSTICK_TIMER_WHEEL_MASK];
+
+    while (NULL != *slot)
+    {
+        timer = *slot;
+        Cy_SysTick_TimerUnlink(timer);
+
+        if ((now - timer->expire) <= (uint32_t)INT32_MAX)
+        {
+            if (0u != timer->period)
+            {
+                timer->expire += timer->period;
+                Cy_SysTick_TimerLink(timer);
+            }
+
+            timer->callback(timer->arg);
+        }
+        else
+        {
+            Cy_SysTick_TimerLink(timer);
+        }
+    }
+}
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) */
+
+
 /*******************************************************************************
 * Function Name: Cy_SysTick_ServiceCallbacks
 ****************************************************************************//**
@@ -219,6 +1159,30 @@ Cy_SysTick_Callback Cy_SysTick_GetCallback(uint32_t number)
 static void Cy_SysTick_ServiceCallbacks(void)
 {
     uint32_t i;
+    uint32_t ticks = 1u + Cy_SysTick_LateTicks;
+
+    Cy_SysTick_LateTicks = 0u;
+
+#if (CY_SYSTICK_TIMER_WHEEL != 0U)
+    while (0u != ticks)
+    {
+        /* Skip the ticks without the timer wheel events at once */
+        if (1u < ticks)
+        {
+            uint32_t skip = Cy_SysTick_TimerGetIdleTicks() - 1u;
+
+            skip = (skip < ticks) ? skip : (ticks - 1u);
+            Cy_SysTick_TickCount += skip;
+            ticks -= skip;
+        }
+
+        Cy_SysTick_TickCount++;
+        Cy_SysTick_ServiceTimers();
+        ticks--;
+    }
+#else
+    Cy_SysTick_TickCount += ticks;
+#endif /* (CY_SYSTICK_TIMER_WHEEL != 0U) */
 
     /* Verify that tick timer flag was set */
     if (0u != Cy_SysTick_GetCountFlag())
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm_counter.c
-* \version 1.0
+* \version 1.10
 *
 * \brief
 *  The source file of the tcpwm driver.
@@ -146,6 +146,349 @@ void Cy_TCPWM_Counter_DeInit(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_cou
     TCPWM_CNT_TR_CTRL0(base, cntNum) = CY_TCPWM_CNT_TR_CTRL0_DEFAULT;
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_CaptureInit
+****************************************************************************//**
+*
+* Initializes the capture service for a counter.
+*
+* The counter must be initialized by \ref Cy_TCPWM_Counter_Init in the Capture
+* mode, counting up with the period 0xFFFF, and capture on the rising edge, or
+* on both edges when bothEdges is true. This function enables its terminal
+* count and capture interrupts; the application calls
+* \ref Cy_TCPWM_Counter_CaptureInterrupt from the counter interrupt handler.
+*
+* \param cap
+* The pointer to the capture service structure allocated by the user.
+*
+* \param base
+* The pointer to a TCPWM instance.
+*
+* \param cntNum
+* The Counter instance number in the selected TCPWM.
+*
+* \param buffer
+* The pointer to the timestamp FIFO buffer allocated by the user. One entry is
+* kept unused to distinguish a full FIFO from an empty one.
+*
+* \param size
+* The size of the buffer, in timestamps. At least 2, or at least 3 when
+* bothEdges is true.
+*
+* \param bothEdges
+* The counter captures on both edges. The first capture is the rising edge.
+*
+* \return error / status code. See \ref cy_en_tcpwm_status_t.
+*
+*******************************************************************************/
+cy_en_tcpwm_status_t Cy_TCPWM_Counter_CaptureInit(cy_stc_tcpwm_counter_capture_t *cap, TCPWM_Type *base,
+                                                  uint32_t cntNum, uint32_t *buffer, uint32_t size, bool bothEdges)
+{
+    cy_en_tcpwm_status_t status = CY_TCPWM_BAD_PARAM;
+
+    if ((NULL != cap) && (NULL != base) && (NULL != buffer) && (size >= (bothEdges ? 3UL : 2UL)))
+    {
+        cap->base          = base;
+        cap->cntNum        = cntNum;
+        cap->buffer        = buffer;
+        cap->size          = size;
+        cap->head          = 0UL;
+        cap->tail          = 0UL;
+        cap->dropped       = 0UL;
+        cap->overflows     = 0UL;
+        cap->bothEdges     = bothEdges;
+        cap->risingNext    = true;
+        cap->skipFalling   = false;
+        cap->readRising    = true;
+        cap->lastRiseValid = false;
+        cap->lastRise      = 0UL;
+        cap->lastDropped   = 0UL;
+
+        Cy_TCPWM_ClearInterrupt(base, cntNum, CY_TCPWM_INT_ON_CC_OR_TC);
+        Cy_TCPWM_SetInterruptMask(base, cntNum, CY_TCPWM_INT_ON_CC_OR_TC);
+
+        status = CY_TCPWM_SUCCESS;
+    }
+
+    return(status);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_CaptureInterrupt
+****************************************************************************//**
+*
+* Counts the counter overflows and stores the captured value, extended to
+* 32 bits, in the timestamp FIFO. Call it from the counter interrupt handler.
+* The execution time does not depend on the FIFO contents.
+*
+* \param cap
+* The pointer to the capture service structure.
+*
+* \note The interrupt must be serviced before the next capture and within
+* half of the counter range after an overflow, as the counter keeps only the
+* last captured value.
+*
+*******************************************************************************/
+void Cy_TCPWM_Counter_CaptureInterrupt(cy_stc_tcpwm_counter_capture_t *cap)
+{
+    uint32_t intrStatus = Cy_TCPWM_GetInterruptStatusMasked(cap->base, cap->cntNum);
+
+    if (0UL != (intrStatus & CY_TCPWM_INT_ON_CC))
+    {
+        uint32_t capture = Cy_TCPWM_Counter_GetCapture(cap->base, cap->cntNum);
+        uint32_t overflows = cap->overflows;
+        uint32_t head = cap->head;
+        uint32_t tail = cap->tail;
+        uint32_t numFree = ((tail > head) ? (tail - head) : ((cap->size - head) + tail)) - 1UL;
+        bool store;
+
+        /* The overflow is pending together with the capture: a small captured
+        * value was taken after the overflow, a large one before it.
+        */
+        if ((0UL != (intrStatus & CY_TCPWM_INT_ON_TC)) && (capture < CY_TCPWM_COUNTER_CAPTURE_HALF))
+        {
+            overflows++;
+        }
+
+        if (!cap->bothEdges)
+        {
+            store = (numFree > 0UL);
+        }
+        else if (cap->risingNext)
+        {
+            /* Reserve the space for the falling edge to keep the pulse whole */
+            store = (numFree >= 2UL);
+            cap->skipFalling = !store;
+        }
+        else
+        {
+            store = !cap->skipFalling;
+        }
+
+        if (store)
+        {
+            cap->buffer[head] = (overflows << CY_TCPWM_COUNTER_CAPTURE_SHIFT) | capture;
+            head++;
+            cap->head = (head < cap->size) ? head : 0UL;
+        }
+        else
+        {
+            cap->dropped++;
+        }
+
+        cap->risingNext = !cap->risingNext;
+    }
+
+    if (0UL != (intrStatus & CY_TCPWM_INT_ON_TC))
+    {
+        cap->overflows++;
+    }
+
+    Cy_TCPWM_ClearInterrupt(cap->base, cap->cntNum, intrStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_CaptureGetNum
+****************************************************************************//**
+*
+* Returns the number of the timestamps in the FIFO.
+*
+* \param cap
+* The pointer to the capture service structure.
+*
+* \return
+* The number of the timestamps available for reading.
+*
+*******************************************************************************/
+uint32_t Cy_TCPWM_Counter_CaptureGetNum(cy_stc_tcpwm_counter_capture_t const *cap)
+{
+    uint32_t head = cap->head;
+    uint32_t tail = cap->tail;
+
+    return((head >= tail) ? (head - tail) : ((cap->size - tail) + head));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_CaptureRead
+****************************************************************************//**
+*
+* Moves up to maxNum timestamps from the FIFO to the application buffer. The
+* timestamps are in the counter clocks and wrap around at 2^32, so the
+* difference of two timestamps is valid while they are less than 2^32 clocks
+* apart. The interrupt is not disabled; the function only advances the FIFO
+* read index after copying the timestamps.
+*
+* \param cap
+* The pointer to the capture service structure.
+*
+* \param timestamps
+* The pointer to the destination buffer.
+*
+* \param maxNum
+* The size of the destination buffer, in timestamps.
+*
+* \return
+* The number of the timestamps read.
+*
+*******************************************************************************/
+uint32_t Cy_TCPWM_Counter_CaptureRead(cy_stc_tcpwm_counter_capture_t *cap, uint32_t *timestamps, uint32_t maxNum)
+{
+    uint32_t num = Cy_TCPWM_Counter_CaptureGetNum(cap);
+    uint32_t tail = cap->tail;
+    uint32_t i;
+
+    CY_ASSERT_L1(NULL != timestamps);
+
+    num = (num < maxNum) ? num : maxNum;
+
+    for (i = 0UL; i < num; i++)
+    {
+        timestamps[i] = cap->buffer[tail];
+        tail++;
+        tail = (tail < cap->size) ? tail : 0UL;
+    }
+
+    cap->tail = tail;
+
+    if (cap->bothEdges && (0UL != (num & 1UL)))
+    {
+        cap->readRising = !cap->readRising;
+    }
+    else
+    {
+        /* The edge order is unchanged */
+    }
+
+    /* The edges read are not seen by Cy_TCPWM_Counter_CaptureMeasure */
+    cap->lastRiseValid = (cap->lastRiseValid && (0UL == num));
+
+    return(num);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_CaptureMeasure
+****************************************************************************//**
+*
+* Drains the FIFO and computes the average frequency of the drained edges and,
+* when capturing on both edges, the average duty cycle.
+*
+* The period is measured between the consecutive rising edges, including the
+* last rising edge of the previous call, so the consecutive calls cover the
+* signal without gaps. The measurement restarts after a capture was dropped
+* or after \ref Cy_TCPWM_Counter_CaptureRead was called. When capturing on
+* both edges, a rising edge whose falling edge is not captured yet stays in
+* the FIFO for the next call.
+*
+* \param cap
+* The pointer to the capture service structure.
+*
+* \param clockFreq
+* The clock frequency of the counter, in Hz.
+*
+* \param result
+* The pointer to the measurement result. The fields are zero when no complete
+* period was measured. See \ref cy_stc_tcpwm_counter_capture_result_t.
+*
+* \return
+* The number of the complete periods measured.
+*
+*******************************************************************************/
+uint32_t Cy_TCPWM_Counter_CaptureMeasure(cy_stc_tcpwm_counter_capture_t *cap, uint32_t clockFreq,
+                                         cy_stc_tcpwm_counter_capture_result_t *result)
+{
+    uint32_t num = Cy_TCPWM_Counter_CaptureGetNum(cap);
+    uint32_t tail = cap->tail;
+    uint32_t edges = cap->bothEdges ? 2UL : 1UL;
+    uint32_t numPeriods = 0UL;
+    uint64_t sumPeriod = 0ULL;
+    uint64_t sumHigh = 0ULL;
+
+    CY_ASSERT_L1(NULL != result);
+
+    /* Skip the falling edge whose rising edge was read by Cy_TCPWM_Counter_CaptureRead */
+    if ((!cap->readRising) && (num > 0UL))
+    {
+        tail++;
+        tail = (tail < cap->size) ? tail : 0UL;
+        num--;
+        cap->readRising = true;
+    }
+    else
+    {
+        /* Aligned to a rising edge */
+    }
+
+    while (num >= edges)
+    {
+        uint32_t rise = cap->buffer[tail];
+
+        tail++;
+        tail = (tail < cap->size) ? tail : 0UL;
+
+        if (cap->lastRiseValid)
+        {
+            sumPeriod += (uint64_t)(rise - cap->lastRise);
+            numPeriods++;
+        }
+
+        if (cap->bothEdges)
+        {
+            uint32_t fall = cap->buffer[tail];
+
+            tail++;
+            tail = (tail < cap->size) ? tail : 0UL;
+
+            if (cap->lastRiseValid)
+            {
+                sumHigh += (uint64_t)(fall - rise);
+            }
+        }
+
+        cap->lastRise = rise;
+        cap->lastRiseValid = true;
+        num -= edges;
+    }
+
+    cap->tail = tail;
+
+    /* A capture dropped on a full FIFO follows the edges drained above */
+    if (cap->dropped != cap->lastDropped)
+    {
+        cap->lastDropped = cap->dropped;
+        cap->lastRiseValid = false;
+    }
+    else
+    {
+        /* No captures lost */
+    }
+
+    result->numPeriods = 0UL;
+    result->period = 0UL;
+    result->frequency = 0UL;
+    result->duty = 0UL;
+
+    if ((0UL != numPeriods) && (0ULL != sumPeriod))
+    {
+        uint64_t frequency = ((((uint64_t)numPeriods * clockFreq) * 1000ULL) + (sumPeriod / 2ULL)) / sumPeriod;
+
+        result->numPeriods = numPeriods;
+        result->period = (uint32_t)(sumPeriod / numPeriods);
+        result->frequency = (frequency > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)frequency;
+        result->duty = (uint32_t)((sumHigh * 10000ULL) / sumPeriod);
+    }
+    else
+    {
+        /* Not enough edges */
+    }
+
+    return(result->numPeriods);
+}
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm_pwm.c
-* \version 1.0
+* \version 1.10
 *
 * \brief
 *  The source file of the tcpwm driver.
@@ -157,6 +157,328 @@ void Cy_TCPWM_PWM_DeInit(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_pwm_con
     TCPWM_CNT_TR_CTRL0(base, cntNum) = CY_TCPWM_CNT_TR_CTRL0_DEFAULT;
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_SeqInit
+****************************************************************************//**
+*
+* Initializes a PWM sequencer that streams a table of compare values, and
+* optionally periods, into a group of PWM counters.
+*
+* The counters must be initialized by \ref Cy_TCPWM_PWM_Init and enabled
+* (\ref Cy_TCPWM_PWM_Enable), but not started. They should have the same
+* period and clock, so that their terminal counts coincide.
+*
+* \param seq
+* The pointer to the sequencer structure allocated by the user.
+*
+* \param base
+* The pointer to a TCPWM instance.
+*
+* \param counters
+* A bit field representing each counter driven by the sequencer. The lowest
+* counter generates the terminal count interrupt that advances the sequence.
+* Bits at or above the number of the device counters are rejected.
+*
+* \param compare
+* The compare table: one value per counter for each step, in ascending counter
+* number order. It must stay allocated while the sequencer runs.
+*
+* \param period
+* The period table: one value per step shared by all counters, or NULL to
+* keep the periods unchanged.
+*
+* \param numSteps
+* The number of the steps in the tables.
+*
+* \return error / status code. See \ref cy_en_tcpwm_status_t.
+*
+*******************************************************************************/
+cy_en_tcpwm_status_t Cy_TCPWM_PWM_SeqInit(cy_stc_tcpwm_pwm_seq_t *seq, TCPWM_Type *base, uint32_t counters,
+                                          uint16_t const *compare, uint16_t const *period, uint32_t numSteps)
+{
+    cy_en_tcpwm_status_t status = CY_TCPWM_BAD_PARAM;
+
+    if ((NULL != seq) && (NULL != base) && (0UL != counters) && (0UL == (counters >> TCPWM_CNT_NR)) &&
+        (NULL != compare) && (numSteps > 0UL))
+    {
+        uint32_t cntNum;
+        uint32_t numChannels = 0UL;
+
+        for (cntNum = 0UL; (cntNum < TCPWM_CNT_NR) && (numChannels <= CY_TCPWM_PWM_SEQ_MAX_CHANNELS); cntNum++)
+        {
+            if (0UL != (counters & (1UL << cntNum)))
+            {
+                if (0UL == numChannels)
+                {
+                    seq->masterNum = cntNum;
+                }
+
+                if (numChannels < CY_TCPWM_PWM_SEQ_MAX_CHANNELS)
+                {
+                    seq->cnt[numChannels] = &base->CNT[cntNum];
+                }
+
+                numChannels++;
+            }
+        }
+
+        if (numChannels <= CY_TCPWM_PWM_SEQ_MAX_CHANNELS)
+        {
+            seq->base         = base;
+            seq->counters     = counters;
+            seq->numChannels  = numChannels;
+            seq->compare      = compare;
+            seq->period       = period;
+            seq->numSteps     = numSteps;
+            seq->step         = 0UL;
+            seq->nextPending  = false;
+
+            status = CY_TCPWM_SUCCESS;
+        }
+    }
+
+    return (status);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_SeqStart
+****************************************************************************//**
+*
+* Starts the sequence from its first step.
+*
+* The first step is written into the active compare (and period) registers and
+* the second step into the buffered ones. The compare (and period) swap and
+* the terminal count interrupt of the lowest counter are enabled and all the
+* counters are started by one \ref Cy_TCPWM_TriggerStart command.
+*
+* \param seq
+* The pointer to the sequencer structure.
+*
+*******************************************************************************/
+void Cy_TCPWM_PWM_SeqStart(cy_stc_tcpwm_pwm_seq_t *seq)
+{
+    uint32_t idx;
+    uint32_t next = (seq->numSteps > 1UL) ? 1UL : 0UL;
+    uint32_t ctrlMask = TCPWM_CNT_CTRL_AUTO_RELOAD_CC_Msk;
+
+    if (NULL != seq->period)
+    {
+        ctrlMask |= TCPWM_CNT_CTRL_AUTO_RELOAD_PERIOD_Msk;
+    }
+
+    for (idx = 0UL; idx < seq->numChannels; idx++)
+    {
+        TCPWM_CNT_Type *cnt = seq->cnt[idx];
+
+        cnt->CC      = seq->compare[idx];
+        cnt->CC_BUFF = seq->compare[(next * seq->numChannels) + idx];
+
+        if (NULL != seq->period)
+        {
+            cnt->PERIOD      = seq->period[0UL];
+            cnt->PERIOD_BUFF = seq->period[next];
+        }
+
+        /* Clear the period swap left from an earlier start with a period table */
+        cnt->CTRL = (cnt->CTRL & ~TCPWM_CNT_CTRL_AUTO_RELOAD_PERIOD_Msk) | ctrlMask;
+    }
+
+    seq->step = (next + 1UL < seq->numSteps) ? (next + 1UL) : 0UL;
+
+    Cy_TCPWM_ClearInterrupt(seq->base, seq->masterNum, CY_TCPWM_INT_ON_CC_OR_TC);
+    Cy_TCPWM_SetInterruptMask(seq->base, seq->masterNum, CY_TCPWM_INT_ON_TC);
+
+    /* Arm the swap of the second step and start all the counters together */
+    Cy_TCPWM_TriggerCaptureOrSwap(seq->base, seq->counters);
+    Cy_TCPWM_TriggerStart(seq->base, seq->counters);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_SeqStop
+****************************************************************************//**
+*
+* Stops advancing the sequence. The counters keep running with the last
+* applied values.
+*
+* \param seq
+* The pointer to the sequencer structure.
+*
+*******************************************************************************/
+void Cy_TCPWM_PWM_SeqStop(cy_stc_tcpwm_pwm_seq_t *seq)
+{
+    Cy_TCPWM_SetInterruptMask(seq->base, seq->masterNum, CY_TCPWM_INT_NONE);
+    Cy_TCPWM_ClearInterrupt(seq->base, seq->masterNum, CY_TCPWM_INT_ON_CC_OR_TC);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_SeqSetTable
+****************************************************************************//**
+*
+* Queues a new table. \ref Cy_TCPWM_PWM_SeqInterrupt switches to it when the
+* current table wraps around, so the waveform stays continuous.
+*
+* \param seq
+* The pointer to the sequencer structure.
+*
+* \param compare
+* The new compare table, in the format of \ref Cy_TCPWM_PWM_SeqInit.
+*
+* \param period
+* The new period table or NULL. It must be NULL exactly when the sequencer was
+* initialized without the period table.
+*
+* \param numSteps
+* The number of the steps in the new tables.
+*
+* \return
+* False if the previously queued table has not been switched to yet, or if
+* the presence of the period table differs from \ref Cy_TCPWM_PWM_SeqInit.
+* The new table is not queued in that case.
+*
+*******************************************************************************/
+bool Cy_TCPWM_PWM_SeqSetTable(cy_stc_tcpwm_pwm_seq_t *seq, uint16_t const *compare,
+                              uint16_t const *period, uint32_t numSteps)
+{
+    bool retVal = false;
+
+    CY_ASSERT_L1(NULL != compare);
+    CY_ASSERT_L2(numSteps > 0UL);
+    CY_ASSERT_L2((NULL == period) == (NULL == seq->period));
+
+    /* Only the interrupt clears the flag, so the fields are not in use when it is false */
+    if ((!seq->nextPending) && ((NULL == period) == (NULL == seq->period)))
+    {
+        seq->nextCompare  = compare;
+        seq->nextPeriod   = period;
+        seq->nextNumSteps = numSteps;
+        seq->nextPending  = true;
+
+        retVal = true;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_SeqInterrupt
+****************************************************************************//**
+*
+* Writes the next step of the sequence into the buffered compare (and period)
+* registers and arms their swap at the next terminal count. Call it from the
+* interrupt handler of the lowest sequenced counter.
+*
+* \param seq
+* The pointer to the sequencer structure.
+*
+*******************************************************************************/
+void Cy_TCPWM_PWM_SeqInterrupt(cy_stc_tcpwm_pwm_seq_t *seq)
+{
+    uint32_t idx;
+    uint32_t step = seq->step;
+    uint16_t const *compare = &seq->compare[step * seq->numChannels];
+
+    Cy_TCPWM_ClearInterrupt(seq->base, seq->masterNum, CY_TCPWM_INT_ON_TC);
+
+    for (idx = 0UL; idx < seq->numChannels; idx++)
+    {
+        seq->cnt[idx]->CC_BUFF = compare[idx];
+    }
+
+    if (NULL != seq->period)
+    {
+        for (idx = 0UL; idx < seq->numChannels; idx++)
+        {
+            seq->cnt[idx]->PERIOD_BUFF = seq->period[step];
+        }
+    }
+
+    /* One command arms the swap on all the counters at the same terminal count */
+    Cy_TCPWM_TriggerCaptureOrSwap(seq->base, seq->counters);
+
+    step++;
+
+    if (step == seq->numSteps)
+    {
+        step = 0UL;
+
+        if (seq->nextPending)
+        {
+            seq->compare     = seq->nextCompare;
+            seq->period      = seq->nextPeriod;
+            seq->numSteps    = seq->nextNumSteps;
+            seq->nextPending = false;
+        }
+    }
+
+    seq->step = step;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_GroupUpdate
+****************************************************************************//**
+*
+* Updates the compare and, optionally, the period values of several PWM
+* counters so that all of them take effect at the same terminal count.
+*
+* The new values are written into the buffered CC_BUFF (and PERIOD_BUFF)
+* registers of every counter and then the swap of all the counters is armed by
+* a single \ref Cy_TCPWM_TriggerCaptureOrSwap command. The counters must be
+* configured with the compare swap (and the period swap) enabled and should
+* have coinciding terminal counts.
+*
+* \param base
+* The pointer to a TCPWM instance.
+*
+* \param updates
+* The array of the counter updates.
+*
+* \param numUpdates
+* The number of the elements in the updates array.
+*
+* \param updatePeriod
+* True to update the periods in addition to the compare values.
+*
+* \note Call this function at most once per PWM period, for example from the
+* terminal count interrupt. If the previous update has not been applied yet,
+* the terminal count can occur while the buffered registers are being written.
+*
+*******************************************************************************/
+void Cy_TCPWM_PWM_GroupUpdate(TCPWM_Type *base, cy_stc_tcpwm_pwm_group_update_t const *updates,
+                              uint32_t numUpdates, bool updatePeriod)
+{
+    uint32_t idx;
+    uint32_t counters = 0UL;
+
+    CY_ASSERT_L1(NULL != updates);
+
+    for (idx = 0UL; idx < numUpdates; idx++)
+    {
+        uint32_t cntNum = updates[idx].cntNum;
+
+        CY_ASSERT_L2(0UL != (TCPWM_CNT_CTRL(base, cntNum) & TCPWM_CNT_CTRL_AUTO_RELOAD_CC_Msk));
+
+        TCPWM_CNT_CC_BUFF(base, cntNum) = updates[idx].compare;
+
+        if (updatePeriod)
+        {
+            CY_ASSERT_L2(0UL != (TCPWM_CNT_CTRL(base, cntNum) & TCPWM_CNT_CTRL_AUTO_RELOAD_PERIOD_Msk));
+
+            TCPWM_CNT_PERIOD_BUFF(base, cntNum) = updates[idx].period;
+        }
+
+        counters |= (1UL << cntNum);
+    }
+
+    /* All the counters swap at their next terminal count */
+    Cy_TCPWM_TriggerCaptureOrSwap(base, counters);
+}
+
 #if defined(__cplusplus)
 }
 #endif
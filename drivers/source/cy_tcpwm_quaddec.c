@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_tcpwm_quaddec.c
-* \version 1.0
+* \version 1.10
 *
 * \brief
 *  The source file of the tcpwm driver.
@@ -24,6 +24,7 @@
 *******************************************************************************/
 
 #include "cy_tcpwm_quaddec.h"
+#include "cy_tcpwm_counter.h"
 
 #ifdef CY_IP_M0S8TCPWM
 
@@ -121,6 +122,241 @@ void Cy_TCPWM_QuadDec_DeInit(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_qua
     TCPWM_CNT_TR_CTRL0(base, cntNum) = CY_TCPWM_CNT_TR_CTRL0_DEFAULT;
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_QuadDec_EstInit
+****************************************************************************//**
+*
+* Initializes the position and velocity estimator for a QuadDec counter.
+*
+* The QuadDec must be initialized by \ref Cy_TCPWM_QuadDec_Init. This function
+* enables its terminal count and capture interrupts; the application calls
+* \ref Cy_TCPWM_QuadDec_EstInterrupt from the QuadDec interrupt handler. The
+* position starts from the current counter value.
+*
+* \param est
+* The pointer to the estimator structure allocated by the user.
+*
+* \param base
+* The pointer to a TCPWM instance.
+*
+* \param cntNum
+* The QuadDec Counter instance number in the selected TCPWM.
+*
+* \param config
+* The pointer to the estimator configuration. See
+* \ref cy_stc_tcpwm_quaddec_est_config_t.
+*
+* \return error / status code. See \ref cy_en_tcpwm_status_t.
+*
+*******************************************************************************/
+cy_en_tcpwm_status_t Cy_TCPWM_QuadDec_EstInit(cy_stc_tcpwm_quaddec_est_t *est, TCPWM_Type *base, uint32_t cntNum,
+                                              cy_stc_tcpwm_quaddec_est_config_t const *config)
+{
+    cy_en_tcpwm_status_t status = CY_TCPWM_BAD_PARAM;
+
+    if ((NULL != est) && (NULL != base) && (NULL != config) && (config->sampleFreq > 0UL) &&
+        ((CY_TCPWM_QUADDEC_EST_NO_TIMER == config->timerNum) ||
+         ((config->timerFreq > 0UL) && (config->countsPerCapture > 0UL))))
+    {
+        est->base        = base;
+        est->cntNum      = cntNum;
+        est->config      = *config;
+        est->accum       = 0;
+        est->updateCount = 0UL;
+        est->idleTicks   = TCPWM_CNT_COUNTER_COUNTER_Msk;
+        est->velocity    = 0L;
+
+        Cy_TCPWM_ClearInterrupt(base, cntNum, CY_TCPWM_INT_ON_CC_OR_TC);
+        Cy_TCPWM_SetInterruptMask(base, cntNum, CY_TCPWM_INT_ON_CC_OR_TC);
+
+        est->lastPos = Cy_TCPWM_QuadDec_EstGetPosition(est);
+
+        status = CY_TCPWM_SUCCESS;
+    }
+
+    return(status);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_QuadDec_EstInterrupt
+****************************************************************************//**
+*
+* Accumulates the counter value captured at the last overflow, underflow or
+* index event. Call it from the QuadDec interrupt handler. The execution time
+* does not depend on the position or the velocity.
+*
+* \param est
+* The pointer to the estimator structure.
+*
+* \note The interrupt must be serviced before the next reload event occurs,
+* as the QuadDec keeps only the last captured value.
+*
+*******************************************************************************/
+void Cy_TCPWM_QuadDec_EstInterrupt(cy_stc_tcpwm_quaddec_est_t *est)
+{
+    uint32_t intrStatus = Cy_TCPWM_GetInterruptStatusMasked(est->base, est->cntNum);
+
+    if (0UL != intrStatus)
+    {
+        /* Read the capture before clearing, as the readout treats a pending
+        * interrupt as not yet accumulated.
+        */
+        int32_t offset = (int32_t) Cy_TCPWM_QuadDec_GetCapture(est->base, est->cntNum) -
+                         (int32_t) CY_TCPWM_QUADDEC_RELOAD_VAL;
+
+        est->accum += offset;
+        est->updateCount++;
+
+        Cy_TCPWM_ClearInterrupt(est->base, est->cntNum, intrStatus);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_QuadDec_EstGetPosition
+****************************************************************************//**
+*
+* Returns the 64-bit position. Interrupts are not disabled: the readout is
+* repeated if \ref Cy_TCPWM_QuadDec_EstInterrupt or a reload event occurred
+* during it. Call it from a context with a lower priority than the QuadDec
+* interrupt.
+*
+* \param est
+* The pointer to the estimator structure.
+*
+* \return
+* The position in QuadDec counts since \ref Cy_TCPWM_QuadDec_EstInit.
+*
+*******************************************************************************/
+int64_t Cy_TCPWM_QuadDec_EstGetPosition(cy_stc_tcpwm_quaddec_est_t const *est)
+{
+    int64_t  position;
+    uint32_t updateCount;
+    uint32_t pending;
+    bool     retry;
+
+    do
+    {
+        updateCount = est->updateCount;
+        position    = est->accum;
+        pending     = Cy_TCPWM_GetInterruptStatus(est->base, est->cntNum) & CY_TCPWM_INT_ON_CC_OR_TC;
+
+        /* The counter is already reloaded, but the interrupt is not serviced yet */
+        if (0UL != pending)
+        {
+            position += (int32_t) Cy_TCPWM_QuadDec_GetCapture(est->base, est->cntNum) -
+                        (int32_t) CY_TCPWM_QUADDEC_RELOAD_VAL;
+        }
+
+        position += (int32_t) Cy_TCPWM_QuadDec_GetCounter(est->base, est->cntNum) -
+                    (int32_t) CY_TCPWM_QUADDEC_RELOAD_VAL;
+
+        retry = (updateCount != est->updateCount) ||
+                (pending != (Cy_TCPWM_GetInterruptStatus(est->base, est->cntNum) & CY_TCPWM_INT_ON_CC_OR_TC));
+    }
+    while (retry);
+
+    return(position);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_QuadDec_EstSample
+****************************************************************************//**
+*
+* Updates the velocity. Call it at the sampleFreq rate set in
+* \ref cy_stc_tcpwm_quaddec_est_config_t, for example from a timer interrupt
+* with a lower priority than the QuadDec interrupt.
+*
+* If the position changed by at least minCounts since the previous call, or
+* there is no capture counter, the velocity is the position change multiplied
+* by sampleFreq. Otherwise, it is countsPerCapture divided by the time between
+* the last two captured edges, or by the time since the last edge if that is
+* longer. The velocity is zero when no edge occurred for the full range of
+* the capture counter.
+*
+* \param est
+* The pointer to the estimator structure.
+*
+*******************************************************************************/
+void Cy_TCPWM_QuadDec_EstSample(cy_stc_tcpwm_quaddec_est_t *est)
+{
+    cy_stc_tcpwm_quaddec_est_config_t const *config = &est->config;
+    int64_t position = Cy_TCPWM_QuadDec_EstGetPosition(est);
+    int64_t delta = position - est->lastPos;
+    int64_t velocity;
+
+    est->lastPos = position;
+
+    if ((CY_TCPWM_QUADDEC_EST_NO_TIMER == config->timerNum) ||
+        ((delta >= (int64_t) config->minCounts) || (delta <= -(int64_t) config->minCounts)))
+    {
+        velocity = delta * (int64_t) config->sampleFreq;
+        est->idleTicks = 0UL;
+    }
+    else
+    {
+        uint32_t lastEdge = Cy_TCPWM_Counter_GetCapture(est->base, config->timerNum);
+        uint32_t period   = (lastEdge - Cy_TCPWM_Counter_GetCaptureBuf(est->base, config->timerNum)) &
+                            TCPWM_CNT_COUNTER_COUNTER_Msk;
+        uint32_t elapsed  = (Cy_TCPWM_Counter_GetCounter(est->base, config->timerNum) - lastEdge) &
+                            TCPWM_CNT_COUNTER_COUNTER_Msk;
+
+        /* Track the time without edges beyond the capture counter range */
+        if (0 != delta)
+        {
+            est->idleTicks = 0UL;
+        }
+        else if (est->idleTicks < TCPWM_CNT_COUNTER_COUNTER_Msk)
+        {
+            est->idleTicks += (config->timerFreq / config->sampleFreq);
+        }
+        else
+        {
+            /* Saturated */
+        }
+
+        if (elapsed > period)
+        {
+            period = elapsed;
+        }
+
+        if ((est->idleTicks >= TCPWM_CNT_COUNTER_COUNTER_Msk) || (0UL == period))
+        {
+            velocity = 0;
+        }
+        else
+        {
+            velocity = ((int64_t) config->countsPerCapture * (int64_t) config->timerFreq) / (int64_t) period;
+
+            /* The sign follows the position change or, without one, the counting direction */
+            if ((delta < 0) || ((0 == delta) &&
+                (0UL != (Cy_TCPWM_QuadDec_GetStatus(est->base, est->cntNum) & CY_TCPWM_QUADDEC_STATUS_DOWN_COUNTING))))
+            {
+                velocity = -velocity;
+            }
+        }
+    }
+
+    /* Saturate to the 32-bit range */
+    if (velocity > (int64_t) INT32_MAX)
+    {
+        velocity = (int64_t) INT32_MAX;
+    }
+    else if (velocity < (int64_t) INT32_MIN)
+    {
+        velocity = (int64_t) INT32_MIN;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    est->velocity = (int32_t) velocity;
+}
+
 #if defined(__cplusplus)
 }
 #endif